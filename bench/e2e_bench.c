@@ -0,0 +1,289 @@
+/*
+End-to-end benchmark of whole shell processes: runs the same scenarios with
+minishell, 'bash --norc' and dash (if installed), each reading its commands
+from a script on stdin (the non-interactive path), with stdout and stderr
+sent to /dev/null:
+
+- startup:		An empty script, i.e. starting up and exiting.
+- fork_exec:	100 times '/bin/true' (one fork and execve each).
+- pipeline_8:	20 pipelines of 8 stages of 'true'.
+- builtin_loop:	1000 times 'echo' (minishell forks for it, others don't).
+- heredoc:		10 heredocs of 1000 lines each, read by 'cat'.
+- for_loop:		100 'for' loops of 10 times 'echo', parsed once per loop.
+- arith:		1000 times 'export n=$((n + 1))', without forking 'expr'.
+- subst:		1000 times 'export s=$(echo hi)', where minishell captures the
+				output of the builtin in memory instead of forking.
+
+Every scenario runs BENCH_REPS times per shell (default: 30), measured from
+fork() to waitpid(), and reports the median and the 99th percentile. A
+separate run under ptrace() counts the system calls of the shell and all
+processes it creates, as timing under ptrace would be meaningless.
+
+Built and run via 'make bench-e2e'. Prints one tab-separated line per
+scenario and shell:
+
+	scenario	shell	runs	median_us	p99_us	syscalls
+*/
+
+#include "../libft/libft.h"
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#define DEFAULT_REPS	30
+#define MAX_REPS		1000
+
+typedef struct s_shell
+{
+	const char	*name;
+	char		*argv[3];
+}	t_shell;
+
+typedef struct s_scenario
+{
+	const char	*name;
+	const char	*line;
+	int			count;
+}	t_scenario;
+
+// Writes 'count' times 'line' into a new temporary file, rewound for reading
+static int	make_script(const char *line, int count)
+{
+	char	path[32];
+	int		fd;
+	size_t	len;
+
+	ft_strlcpy(path, "/tmp/minishell_e2e_XXXXXX", sizeof(path));
+	fd = mkstemp(path);
+	if (fd == -1)
+		return (-1);
+	unlink(path);
+	len = ft_strlen(line);
+	while (count-- > 0)
+	{
+		if (write(fd, line, len) != (ssize_t)len)
+			return (close(fd), -1);
+	}
+	if (lseek(fd, 0, SEEK_SET) == -1)
+		return (close(fd), -1);
+	return (fd);
+}
+
+// In the child: reads the script from stdin, discards all output
+static void	exec_shell(t_shell *shell, int script, int traced)
+{
+	int	null;
+
+	null = open("/dev/null", O_WRONLY);
+	if (null == -1 || dup2(script, STDIN_FILENO) == -1
+		|| dup2(null, STDOUT_FILENO) == -1 || dup2(null, STDERR_FILENO) == -1)
+		_exit(127);
+	if (traced)
+	{
+		ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+		raise(SIGSTOP);
+	}
+	execvp(shell->argv[0], shell->argv);
+	_exit(127);
+}
+
+// Runs the shell once, returns the elapsed time in us (-1 if it failed)
+static double	run_once(t_shell *shell, int script)
+{
+	struct timespec	start;
+	struct timespec	end;
+	pid_t			pid;
+	int				status;
+
+	if (lseek(script, 0, SEEK_SET) == -1)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	pid = fork();
+	if (pid == -1)
+		return (-1);
+	if (pid == 0)
+		exec_shell(shell, script, 0);
+	if (waitpid(pid, &status, 0) == -1)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	if (WIFEXITED(status) && WEXITSTATUS(status) == 127)
+		return (-1);
+	return ((end.tv_sec - start.tv_sec) * 1e6
+		+ (end.tv_nsec - start.tv_nsec) / 1e3);
+}
+
+/*
+Continues all traced processes until the last one exited, counting the
+syscall stops. Each syscall stops twice (entry and exit), so the count is
+halved. Processes created by the shell are traced automatically and start
+with a SIGSTOP, which is suppressed.
+*/
+static long	trace_syscalls(void)
+{
+	long	stops;
+	pid_t	pid;
+	int		status;
+	int		sig;
+
+	stops = 0;
+	pid = waitpid(-1, &status, __WALL);
+	while (pid > 0)
+	{
+		sig = 0;
+		if (WIFSTOPPED(status) && WSTOPSIG(status) == (SIGTRAP | 0x80))
+			stops++;
+		else if (WIFSTOPPED(status) && WSTOPSIG(status) != SIGTRAP
+			&& WSTOPSIG(status) != SIGSTOP)
+			sig = WSTOPSIG(status);
+		if (WIFSTOPPED(status))
+			ptrace(PTRACE_SYSCALL, pid, NULL, sig);
+		pid = waitpid(-1, &status, __WALL);
+	}
+	return (stops / 2);
+}
+
+// Runs the shell once under ptrace(), returns its syscall count (-1: failed)
+static long	count_syscalls(t_shell *shell, int script)
+{
+	pid_t	pid;
+	int		status;
+
+	if (lseek(script, 0, SEEK_SET) == -1)
+		return (-1);
+	pid = fork();
+	if (pid == -1)
+		return (-1);
+	if (pid == 0)
+		exec_shell(shell, script, 1);
+	if (waitpid(pid, &status, 0) == -1 || !WIFSTOPPED(status)
+		|| ptrace(PTRACE_SETOPTIONS, pid, NULL, PTRACE_O_TRACESYSGOOD
+			| PTRACE_O_TRACEFORK | PTRACE_O_TRACEVFORK | PTRACE_O_TRACECLONE
+			| PTRACE_O_EXITKILL) == -1)
+	{
+		kill(pid, SIGKILL);
+		waitpid(pid, &status, 0);
+		return (-1);
+	}
+	ptrace(PTRACE_SYSCALL, pid, NULL, 0);
+	return (trace_syscalls());
+}
+
+static int	cmp_double(const void *a, const void *b)
+{
+	double	x;
+	double	y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return ((x > y) - (x < y));
+}
+
+static void	bench(t_scenario *sc, t_shell *shell, int script, int reps)
+{
+	static double	us[MAX_REPS];
+	long			syscalls;
+	int				i;
+
+	i = 0;
+	while (i < reps)
+	{
+		us[i] = run_once(shell, script);
+		if (us[i++] < 0)
+		{
+			printf("%s\t%s\tskipped\n", sc->name, shell->name);
+			return ;
+		}
+	}
+	qsort(us, reps, sizeof(double), cmp_double);
+	syscalls = count_syscalls(shell, script);
+	printf("%s\t%s\t%d\t%.0f\t%.0f\t", sc->name, shell->name, reps,
+		us[reps / 2], us[(reps * 99 + 99) / 100 - 1]);
+	if (syscalls < 0)
+		printf("-\n");
+	else
+		printf("%ld\n", syscalls);
+	fflush(stdout);
+}
+
+// Builds the heredoc scenario's line: 'cat << EOF', 1000 lines, 'EOF'
+static char	*heredoc_line(void)
+{
+	t_strbuf	sb;
+	int			i;
+
+	ft_sb_init(&sb);
+	if (!ft_sb_adds(&sb, "cat << EOF\n"))
+		return (NULL);
+	i = 0;
+	while (i++ < 1000)
+	{
+		if (!ft_sb_adds(&sb, "the quick brown fox jumps over the lazy dog\n"))
+			return (ft_sb_free(&sb), NULL);
+	}
+	if (!ft_sb_adds(&sb, "EOF\n"))
+		return (ft_sb_free(&sb), NULL);
+	return (ft_sb_steal(&sb));
+}
+
+// The number of runs per scenario and shell, from BENCH_REPS
+static int	get_reps(void)
+{
+	char	*value;
+
+	value = getenv("BENCH_REPS");
+	if (value && ft_atoi(value) > 0 && ft_atoi(value) <= MAX_REPS)
+		return (ft_atoi(value));
+	return (DEFAULT_REPS);
+}
+
+static int	run_all(t_shell *shells, t_scenario *sc, int reps)
+{
+	int	i;
+	int	j;
+	int	script;
+
+	printf("scenario\tshell\truns\tmedian_us\tp99_us\tsyscalls\n");
+	i = -1;
+	while (++i < 8)
+	{
+		script = make_script(sc[i].line, sc[i].count);
+		if (script == -1)
+			return (perror("script"), 1);
+		j = -1;
+		while (++j < 3)
+			bench(&sc[i], &shells[j], script, reps);
+		close(script);
+	}
+	return (0);
+}
+
+int	main(int argc, char **argv)
+{
+	t_shell		shells[3];
+	t_scenario	sc[8];
+	int			ret;
+
+	if (argc != 2)
+		return (fprintf(stderr, "usage: %s path/to/minishell\n", argv[0]), 1);
+	shells[0] = (t_shell){"minishell", {argv[1], NULL, NULL}};
+	shells[1] = (t_shell){"bash", {"bash", "--norc", NULL}};
+	shells[2] = (t_shell){"dash", {"dash", NULL, NULL}};
+	sc[0] = (t_scenario){"startup", "", 0};
+	sc[1] = (t_scenario){"fork_exec", "/bin/true\n", 100};
+	sc[2] = (t_scenario){"pipeline_8", "true | true | true | true | true | true"
+		" | true | true\n", 20};
+	sc[3] = (t_scenario){"builtin_loop", "echo hello world\n", 1000};
+	sc[4] = (t_scenario){"heredoc", heredoc_line(), 10};
+	sc[5] = (t_scenario){"for_loop", "for i in 0 1 2 3 4 5 6 7 8 9; do echo $i;"
+		" done\n", 100};
+	sc[6] = (t_scenario){"arith", "export n=$((n + 1))\n", 1000};
+	sc[7] = (t_scenario){"subst", "export s=$(echo hi)\n", 1000};
+	if (!sc[4].line)
+		return (1);
+	ret = run_all(shells, sc, get_reps());
+	free((char *)sc[4].line);
+	return (ret);
+}
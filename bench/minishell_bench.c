@@ -0,0 +1,316 @@
+/*
+Micro-benchmark of the shell's front end and environment handling: the
+tokenizer (get_tokens), the parser (parse_tokens), variable expansion
+(expand_variables), quote removal (trim_paired_quotes), export / unset,
+variable lookup and the conversion of the environment for execve()
+(conv_env_tmp_to_arr), each over generated workloads: long lines, many
+tokens, many variables and deeply nested quotes, as well as pathname
+expansion over a generated directory of GLOB_FILES files.
+
+Built with optimizations and allocation counting (see libft/ft_memstat.c) and
+run via 'make bench'. Prints one tab-separated line per benchmark, so results
+of two commits can be compared with standard tools:
+
+	name	input_bytes	iterations	ns_per_op	allocs_per_op	bytes_per_op
+
+Allocations include the copy of the input, where an operation consumes it.
+*/
+
+#include "minishell.h"
+#include <stdio.h>
+
+#define ENV_VARS	256
+#define EXP_VARS	64
+#define LINE_BYTES	4096
+#define MIN_NS		100000000L
+#define GLOB_FILES	100000
+
+volatile __sig_atomic_t	g_signal = 0;
+
+typedef void	(*t_op)(t_data *data, const char *arg);
+
+typedef struct s_result
+{
+	long	iters;
+	double	ns;
+	size_t	allocs;
+	size_t	bytes;
+}	t_result;
+
+static void	op_tokens(t_data *data, const char *line)
+{
+	data->input = (char *)line;
+	if (!get_tokens(data))
+		exit(1);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok.tok_last = NULL;
+	data->input = NULL;
+}
+
+static void	op_parse(t_data *data, const char *line)
+{
+	data->input = (char *)line;
+	if (!get_tokens(data) || !parse_tokens(data))
+		exit(1);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok.tok_last = NULL;
+	data->input = NULL;
+}
+
+static void	op_expand(t_data *data, const char *str)
+{
+	char	*copy;
+
+	copy = ft_strdup(str);
+	if (!copy || !expand_variables(&copy, data, 0))
+		exit(1);
+	free(copy);
+}
+
+static void	op_trim(t_data *data, const char *str)
+{
+	char	*trimmed;
+
+	(void)data;
+	trimmed = trim_paired_quotes(str);
+	if (!trimmed)
+		exit(1);
+	free(trimmed);
+}
+
+// Exports a new variable and unsets it again, so the lists keep their size
+static void	op_export_unset(t_data *data, const char *arg)
+{
+	t_exec	exec;
+	char	*flags[3];
+
+	add_env_var_envp_with_value(data, (char *)arg);
+	add_env_var_export_with_value(data, (char *)arg);
+	flags[0] = "unset";
+	flags[1] = "BENCH_NEW";
+	flags[2] = NULL;
+	exec.flags = flags;
+	unset(&exec, &data->envp_temp);
+	unset(&exec, &data->export_list);
+}
+
+static void	op_lookup(t_data *data, const char *name)
+{
+	if (!get_env_value(data->envp_temp, name))
+		exit(1);
+}
+
+static void	op_env_arr(t_data *data, const char *arg)
+{
+	t_exec	exec;
+
+	(void)arg;
+	conv_env_tmp_to_arr(data, &exec);
+	ft_freearray(exec.envp_temp_arr);
+}
+
+static size_t	total_bytes(void)
+{
+	size_t	bytes;
+	int		phase;
+
+	bytes = 0;
+	phase = 0;
+	while (phase < FT_MS_PHASES)
+		bytes += ft_memstat()->phase_bytes[phase++];
+	return (bytes);
+}
+
+static double	elapsed_ns(struct timespec *start)
+{
+	struct timespec	end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return ((end.tv_sec - start->tv_sec) * 1e9
+		+ (end.tv_nsec - start->tv_nsec));
+}
+
+// Doubles the number of iterations until a run takes at least MIN_NS
+static t_result	measure(t_data *data, t_op op, const char *arg)
+{
+	struct timespec	start;
+	t_result		res;
+	long			i;
+
+	res.iters = 1;
+	while (1)
+	{
+		res.allocs = ft_memstat()->allocs;
+		res.bytes = total_bytes();
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		i = 0;
+		while (i++ < res.iters)
+			op(data, arg);
+		res.ns = elapsed_ns(&start);
+		res.allocs = ft_memstat()->allocs - res.allocs;
+		res.bytes = total_bytes() - res.bytes;
+		if (res.ns >= MIN_NS)
+			return (res);
+		res.iters *= 2;
+	}
+}
+
+static void	bench(t_data *data, const char *name, t_op op, const char *arg)
+{
+	t_result	res;
+
+	op(data, arg);
+	res = measure(data, op, arg);
+	printf("%s\t%zu\t%ld\t%.1f\t%.2f\t%.1f\n", name, ft_strlen(arg),
+		res.iters, res.ns / res.iters, (double)res.allocs / res.iters,
+		(double)res.bytes / res.iters);
+}
+
+// Returns 'head' followed by copies of 'piece', at least 'bytes' long
+static char	*repeat(t_strbuf *sb, const char *head, const char *piece,
+	size_t bytes)
+{
+	ft_sb_reset(sb);
+	if (!ft_sb_adds(sb, head))
+		exit(1);
+	while (sb->len < bytes)
+	{
+		if (!ft_sb_adds(sb, piece))
+			exit(1);
+	}
+	return (ft_strdup(sb->buf));
+}
+
+// ENV_VARS variables V0..V255 with short values, plus PATH and HOME
+static char	**make_envp(void)
+{
+	char	**envp;
+	int		i;
+
+	envp = malloc(sizeof(char *) * (ENV_VARS + 3));
+	if (!envp)
+		exit(1);
+	i = 0;
+	while (i < ENV_VARS)
+	{
+		envp[i] = malloc(32);
+		if (!envp[i])
+			exit(1);
+		snprintf(envp[i], 32, "V%d=value_of_%d", i, i);
+		i++;
+	}
+	envp[i++] = "PATH=/usr/local/bin:/usr/bin:/bin";
+	envp[i++] = "HOME=/home/bench";
+	envp[i] = NULL;
+	return (envp);
+}
+
+static void	free_envp(char **envp)
+{
+	int	i;
+
+	i = 0;
+	while (i < ENV_VARS)
+		free(envp[i++]);
+	free(envp);
+}
+
+static void	init_bench_data(t_data *data, char **envp)
+{
+	ft_bzero(data, sizeof(t_data));
+	data->envp = envp;
+	data->envp_temp = init_env_tmp(envp);
+	data->export_list = init_export_list(data);
+	if (!data->envp_temp || !data->export_list)
+		exit(1);
+}
+
+static void	run_workloads(t_data *data, t_strbuf *sb)
+{
+	char	*s[5];
+
+	s[0] = repeat(sb, "echo ", "abcdefghijklmnopqrstuvwxyz", LINE_BYTES);
+	s[1] = repeat(sb, "cat f", " | grep -v x > out 2>&1 < in", LINE_BYTES);
+	s[2] = repeat(sb, "echo", " $V1 \"$V2\" '$V3'", LINE_BYTES);
+	s[3] = repeat(sb, "", "$V255 ", EXP_VARS * 6);
+	s[4] = repeat(sb, "", "\"a'b\"'c\"d'", LINE_BYTES);
+	bench(data, "tokens_long_word", op_tokens, s[0]);
+	bench(data, "tokens_many", op_tokens, s[1]);
+	bench(data, "parse_vars_quotes", op_parse, s[2]);
+	bench(data, "parse_many", op_parse, s[1]);
+	bench(data, "expand_many_vars", op_expand, s[3]);
+	bench(data, "trim_deep_quotes", op_trim, s[4]);
+	bench(data, "export_unset", op_export_unset, "BENCH_NEW=1");
+	bench(data, "env_lookup_last", op_lookup, "V255");
+	bench(data, "env_to_array", op_env_arr, "");
+	free(s[0]);
+	free(s[1]);
+	free(s[2]);
+	free(s[3]);
+	free(s[4]);
+}
+
+// Creates a temporary directory with GLOB_FILES empty files f000000.txt, ...
+// (or removes them and the directory again, if 'remove' is set)
+static void	glob_dir_files(const char *dir, int remove)
+{
+	char	path[64];
+	int		fd;
+	int		i;
+
+	i = 0;
+	while (i < GLOB_FILES)
+	{
+		snprintf(path, sizeof(path), "%s/f%06d.txt", dir, i++);
+		if (remove)
+			unlink(path);
+		else
+		{
+			fd = open(path, O_CREAT | O_WRONLY | O_CLOEXEC, 0644);
+			if (fd == -1)
+				exit(1);
+			close(fd);
+		}
+	}
+	if (remove)
+		rmdir(dir);
+}
+
+// Globbing a directory of GLOB_FILES entries: one pattern matching 1% of
+// them, one matching all of them (dominated by sorting and creating tokens)
+static void	run_glob_workloads(t_data *data)
+{
+	char	dir[32];
+	char	line[2][64];
+
+	ft_strlcpy(dir, "/tmp/minishell_bench_XXXXXX", sizeof(dir));
+	if (!mkdtemp(dir))
+		exit(1);
+	glob_dir_files(dir, 0);
+	snprintf(line[0], sizeof(line[0]), "echo %s/*99.txt", dir);
+	snprintf(line[1], sizeof(line[1]), "echo %s/f*.txt", dir);
+	bench(data, "glob_1pct_of_100k", op_parse, line[0]);
+	bench(data, "glob_all_of_100k", op_parse, line[1]);
+	glob_dir_files(dir, 1);
+}
+
+int	main(void)
+{
+	t_data		data;
+	t_strbuf	sb;
+	char		**envp;
+
+	envp = make_envp();
+	init_bench_data(&data, envp);
+	ft_sb_init(&sb);
+	printf("name\tinput_bytes\titerations\tns_per_op\tallocs_per_op"
+		"\tbytes_per_op\n");
+	run_workloads(&data, &sb);
+	run_glob_workloads(&data);
+	ft_sb_free(&sb);
+	free_env_struct(&data.envp_temp);
+	free_env_struct(&data.export_list);
+	free_env_slab();
+	free_envp(envp);
+	return (0);
+}
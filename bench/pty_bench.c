@@ -0,0 +1,244 @@
+/*
+Latency benchmark of the interactive path: runs minishell on a pseudo-terminal
+(forkpty), types scripted input into it and timestamps its output, to measure
+what a user waits for:
+
+- startup:			From fork until the first prompt is printed, i.e. init,
+					print_logo() and init_history() with an empty history.
+- startup_hist_10k:	The same with a history file of 10000 lines.
+- empty:			From pressing Enter on an empty line to the next prompt.
+- cd:				... after 'cd .' (a builtin run in the shell itself).
+- pwd:				... after 'pwd' (a builtin run in a child process).
+- external:			... after '/bin/true'.
+
+Each interactive scenario is measured BENCH_REPS times (default: 100) in one
+session, each startup scenario BENCH_REPS / 10 times (at least 3). The shell
+runs in a temporary directory, so its history file doesn't touch the
+user's. A prompt is recognized by the text "minishell$ " in the output.
+
+Built and run via 'make bench-pty'. Prints one tab-separated line per
+scenario:
+
+	scenario	runs	median_us	p99_us
+*/
+
+#define _GNU_SOURCE
+#include "../libft/libft.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <pty.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#define PROMPT_TEXT		"minishell$ "
+#define DEFAULT_REPS	100
+#define MAX_REPS		1000
+#define TIMEOUT_MS		5000
+#define WINDOW			4096
+
+typedef struct s_pty
+{
+	int		fd;
+	pid_t	pid;
+	char	buf[WINDOW + 1];
+	size_t	len;
+}	t_pty;
+
+static double	now_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e6 + ts.tv_nsec / 1e3);
+}
+
+/*
+Reads the shell's output until it contains the prompt. Only the last part of
+the output is kept (enough to hold a prompt), which is cleared once the
+prompt is found. Returns the time the prompt arrived, or -1 on timeout or if
+the shell exited.
+*/
+static double	wait_for_prompt(t_pty *p)
+{
+	struct pollfd	pfd;
+	ssize_t			n;
+
+	pfd.fd = p->fd;
+	pfd.events = POLLIN;
+	while (poll(&pfd, 1, TIMEOUT_MS) == 1)
+	{
+		if (p->len > WINDOW / 2)
+		{
+			ft_memmove(p->buf, p->buf + p->len - 64, 64);
+			p->len = 64;
+		}
+		n = read(p->fd, p->buf + p->len, WINDOW - p->len);
+		if (n <= 0)
+			return (-1);
+		p->len += n;
+		p->buf[p->len] = '\0';
+		if (memmem(p->buf, p->len, PROMPT_TEXT, ft_strlen(PROMPT_TEXT)))
+		{
+			p->len = 0;
+			return (now_us());
+		}
+	}
+	return (-1);
+}
+
+// Starts the shell on a new pseudo-terminal, returns the time to its prompt
+static double	start_shell(t_pty *p, char *path)
+{
+	struct winsize	ws;
+	double			start;
+	char			*argv[2];
+
+	ft_bzero(&ws, sizeof(ws));
+	ws.ws_row = 24;
+	ws.ws_col = 80;
+	p->len = 0;
+	start = now_us();
+	p->pid = forkpty(&p->fd, NULL, NULL, &ws);
+	if (p->pid == -1)
+		return (-1);
+	if (p->pid == 0)
+	{
+		argv[0] = path;
+		argv[1] = NULL;
+		execv(path, argv);
+		_exit(127);
+	}
+	start = wait_for_prompt(p) - start;
+	if (start < 0)
+		return (-1);
+	return (start);
+}
+
+static void	stop_shell(t_pty *p)
+{
+	if (p->pid <= 0)
+		return ;
+	kill(p->pid, SIGKILL);
+	waitpid(p->pid, NULL, 0);
+	close(p->fd);
+}
+
+static int	cmp_double(const void *a, const void *b)
+{
+	double	x;
+	double	y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return ((x > y) - (x < y));
+}
+
+static void	report(const char *name, double *us, int runs)
+{
+	qsort(us, runs, sizeof(double), cmp_double);
+	printf("%s\t%d\t%.0f\t%.0f\n", name, runs, us[runs / 2],
+		us[(runs * 99 + 99) / 100 - 1]);
+	fflush(stdout);
+}
+
+// Measures starting the shell 'runs' times, with 'hist_lines' of history
+static int	bench_startup(const char *name, char *path, int runs,
+	int hist_lines)
+{
+	static double	us[MAX_REPS];
+	t_pty			p;
+	int				fd;
+	int				i;
+
+	fd = open(".minishell_history", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd == -1)
+		return (0);
+	while (hist_lines-- > 0)
+		ft_putstr_fd("echo a line of history\n", fd);
+	close(fd);
+	i = 0;
+	while (i < runs)
+	{
+		us[i] = start_shell(&p, path);
+		stop_shell(&p);
+		if (us[i++] < 0)
+			return (0);
+	}
+	report(name, us, runs);
+	return (1);
+}
+
+// Measures the time from Enter to the next prompt for one input line
+static int	bench_line(t_pty *p, const char *name, const char *line, int runs)
+{
+	static double	us[MAX_REPS];
+	double			start;
+	size_t			len;
+	int				i;
+
+	len = ft_strlen(line);
+	i = 0;
+	while (i < runs)
+	{
+		if (write(p->fd, line, len - 1) != (ssize_t)len - 1)
+			return (0);
+		usleep(1000);
+		start = now_us();
+		if (write(p->fd, line + len - 1, 1) != 1)
+			return (0);
+		us[i] = wait_for_prompt(p) - start;
+		if (us[i++] < 0)
+			return (0);
+	}
+	report(name, us, runs);
+	return (1);
+}
+
+static int	run_all(char *path, int reps)
+{
+	t_pty	p;
+	int		ok;
+
+	printf("scenario\truns\tmedian_us\tp99_us\n");
+	if (!bench_startup("startup", path, reps / 10 + 3, 0)
+		|| !bench_startup("startup_hist_10k", path, reps / 10 + 3, 10000))
+		return (0);
+	if (start_shell(&p, path) < 0)
+		return (stop_shell(&p), 0);
+	ok = bench_line(&p, "empty", "\r", reps)
+		&& bench_line(&p, "cd", "cd .\r", reps)
+		&& bench_line(&p, "pwd", "pwd\r", reps)
+		&& bench_line(&p, "external", "/bin/true\r", reps);
+	stop_shell(&p);
+	return (ok);
+}
+
+int	main(int argc, char **argv)
+{
+	char	dir[32];
+	char	*path;
+	char	*reps;
+	int		ok;
+
+	if (argc != 2)
+		return (fprintf(stderr, "usage: %s path/to/minishell\n", argv[0]), 1);
+	path = realpath(argv[1], NULL);
+	ft_strlcpy(dir, "/tmp/minishell_pty_XXXXXX", sizeof(dir));
+	if (!path || !mkdtemp(dir) || chdir(dir) == -1)
+		return (perror("setup"), free(path), 1);
+	reps = getenv("BENCH_REPS");
+	if (reps && ft_atoi(reps) > 0 && ft_atoi(reps) <= MAX_REPS)
+		ok = run_all(path, ft_atoi(reps));
+	else
+		ok = run_all(path, DEFAULT_REPS);
+	if (!ok)
+		fprintf(stderr, "pty_bench: no prompt within %d ms\n", TIMEOUT_MS);
+	unlink(".minishell_history");
+	chdir("/");
+	rmdir(dir);
+	free(path);
+	return (!ok);
+}
@@ -1,6 +1,6 @@
 /**
 Declarations for built-in minishell commands and their utility functions:
-`cd`, `pwd`, `exit`, `env`, `unset`, `export`, and `echo`.
+`cd`, `pwd`, `exit`, `env`, `unset`, `export`, `echo` and `let`.
 */
 
 #ifndef BUILTINS_H
@@ -21,6 +21,16 @@ int				is_exit(t_data *data, t_exec *exec);
 unsigned int	exit_with_code(t_data *data, t_exec *exec);
 int				export(t_data *data, t_exec *exec);
 int				minishell_echo(t_exec *exec);
+int				minishell_times(t_exec *exec);
+int				minishell_memstat(t_exec *exec);
+int				minishell_let(t_data *data, t_exec *exec);
+int				add_duration(t_strbuf *sb, long usec);
+
+// Reserved word "time":
+
+void			start_timing(t_data *data);
+void			add_child_usage(t_data *data, struct rusage *usage);
+void			report_timing(t_data *data);
 
 // Butiltins utils:
 
@@ -30,6 +40,11 @@ void			add_env_var_envp_with_value(t_data *data, char *arg);
 void			ft_env_tmp_add_back(t_env **head, t_env *new);
 int				count_array_length(char **array);
 
+// Builtin output:
+
+void			out_add(t_exec *exec, const char *s);
+int				out_flush(t_exec *exec);
+
 // Modified standard functions:
 
 int				ft_strchr_index(const char *s, int c);
@@ -29,4 +29,40 @@ used for terminal formatting, prompt definitions, history configurations etc.
 
 # define MAX_BUFFER		1024
 
+// Environment variable to set the capacity of pipeline pipes, e.g.
+// 'MINISHELL_PIPEBUF=1M ./minishell' (suffixes 'K' and 'M'; default: kernel's).
+# define PIPE_BUF_VAR	"MINISHELL_PIPEBUF"
+
+// Environment variable to enable the per-phase latency trace (see trace.h):
+// 'MINISHELL_TRACE=1' writes it to stderr, any other value is used as the
+// path of a file to append it to.
+# define TRACE_VAR		"MINISHELL_TRACE"
+// Number of histogram buckets per phase (the last one: >= 2^22 us = ~4 s).
+# define TRACE_BUCKETS	24
+
+// Parse cache (see tokenizer_cache.c): the number of command lines whose
+// tokens are kept, and the longest line that is cached.
+# define PARSE_CACHE_SIZE	32
+# define PARSE_CACHE_MAX_LEN	4096
+
+// Arithmetic (see parser_arith_eval.c): how deep the values of variables used
+// in an expression may refer to other variables, e.g. 'a=b b=c c=1'.
+# define ARITH_MAX_DEPTH	64
+
+// Command substitution (see execution_subst.c): how many bytes of the output
+// of a forked command are read at once.
+# define SUBST_READ_SIZE	4096
+
+// Process substitution (see execution_procsubst.c): the directory through
+// which the command accesses the pipe of '<(cmd)' or '>(cmd)' as a file.
+# define PROCSUBST_DIR	"/dev/fd/"
+
+// Process substitution: the shell's end of the pipe is moved to the highest
+// free fd up to this one, above those redirections like '3>file' usually name.
+# define PROCSUBST_FD_MAX	63
+
+// Highest fd inspected by the fd leak check before execve(), which is enabled
+// via 'make DEBUG_FDS=1'.
+# define FD_CHECK_MAX	1024
+
 #endif
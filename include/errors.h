@@ -11,15 +11,29 @@ e.g. consistency, easier management, clearer code structure and maintenance.
 # define ERR_MALLOC			"ERROR: malloc() failed"
 # define ERR_GET_CWD		"ERROR: Failed to retrieve the working directory"
 # define ERR_HIST_FILE		"ERROR: Unable to set the path to the history file"
+# define ERR_READ_SCRIPT	"ERROR: Failed to read the input"
 # define ERR_PREFIX			"minishell: "
 # define ERR_SYNTAX			"syntax error after "
 # define ERR_EMPTY_PIPE		"syntax error before '|': 'missing input"
+# define ERR_SYNTAX_NEAR	"syntax error near unexpected token `"
+# define ERR_SYNTAX_EOF		"syntax error: unexpected end of file"
 # define ERR_NOT_CLOSED_PRE	"quotation "
 # define ERR_NOT_CLOSED_SUF " is not closed (position: "
 # define ERR_TOKEN			"ERROR: Tokenization failed"
 # define ERR_PARSE_HEREDOC 	"ERROR: Heredoc parsing failed"
 # define ERR_DEL_HEREDOC	"ERROR: Failed to delete heredoc file"
 # define ERR_EXP_VAR		"ERROR: Variable expansion failed"
+# define ERR_ARITH_OPERAND	"syntax error: operand expected"
+# define ERR_ARITH_SYNTAX	"syntax error in expression"
+# define ERR_ARITH_DIV_0	"division by 0"
+# define ERR_ARITH_EXP		"exponent less than 0"
+# define ERR_ARITH_BASE		"value too great for base"
+# define ERR_ARITH_PAREN	"missing `)'"
+# define ERR_ARITH_COLON	"`:' expected for conditional expression"
+# define ERR_ARITH_DEPTH	"expression recursion level exceeded"
+# define ERR_BAD_SUBST		"bad substitution"
+# define ERR_SUBSTR_NEG		"substring expression < 0"
+# define ERR_PARAM_ASSIGN	"cannot assign in this way"
 # define ERR_TRIM_QUOTE		"ERROR: Removal of paired quotes failed"
 # define ERR_GET_T_ATT		"ERROR: Failed to retrieve terminal attributes"
 # define ERR_SET_T_ATT		"ERROR: Failed to set new terminal attributes"
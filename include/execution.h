@@ -14,8 +14,31 @@ redirections, execution of commands and built-ins and error handling.
 void	execution(t_data *data, t_exec *exec, int position);
 int		execution_only_in_parent(t_data *data, t_exec *exec);
 
+// 3_Execution_compound:
+
+void	run_list(t_data *data, t_node *node);
+void	run_compound(t_data *data);
+void	run_for(t_data *data, t_node *node);
+
+// 3_Execution_subst:
+
+int		command_subst(t_data *data, char *cmd, t_strbuf *out);
+void	run_tokens(t_data *data);
+int		capture_child(t_data *data, t_strbuf *out);
+int		with_command_line(t_data *data, char *cmd,
+			int (*run)(t_data *, void *), void *arg);
+void	run_subshell(t_data *data, int keep, int other, int target);
+
+// 3_Execution_procsubst:
+
+int		start_procsubst(t_data *data, char *cmd, char dir);
+void	finish_procsubst(t_data *data);
+int		open_procsubst_pipe(t_procsubst *ps, int fds[2]);
+void	pass_procsubst_fds(t_data *data, t_exec *exec);
+
 // 3_Exeuction_prep:
 
+t_exec	*set_exec_members_to_null(t_exec *exec);
 int		init_exec(t_data *data);
 void	reset_exec(t_exec *exec);
 void	create_child_processes(t_data *data, t_exec *exec);
@@ -30,17 +53,25 @@ void	get_correct_path(t_data *data, t_exec *exec);
 
 // 3_Execution_piping:
 
-void	create_pipe(t_data *data, t_exec *exec);
-void	handle_pipe_in_parent(t_data *data, t_exec *exec);
-void	close_pipe_in_parent(t_data *data, t_exec *exec);
+void	create_pipes(t_data *data, t_exec *exec);
+void	close_pipes(t_data *data, t_exec *exec);
+
+// 3_Execution_herestrings:
+
+void	open_herestrings(t_data *data, t_exec *exec);
+void	close_herestrings(t_data *data);
 
 // 3_Execution_redirections:
 
-void	check_file_exist_child(t_data *data, t_exec *exec);
-void	check_file_exist_parent(t_data *data, t_exec *exec);
-void	check_redirections(t_data *data, t_exec *exec, int position);
+void	collect_redirections(t_data *data, t_exec *exec, int position);
+int		open_redirection(t_redir *redir);
+int		check_redirections(t_data *data, t_exec *exec);
 void	do_redirections(t_data *data, t_exec *exec);
 
+// 3_Execution_fd_check:
+
+void	check_fd_leaks(t_data *data, t_exec *exec);
+
 // 3_Execution_freeing_functions:
 void	free_children(t_child *child);
 int		free_exec(t_exec *exec);
@@ -50,6 +81,7 @@ int		free_exec(t_exec *exec);
 void	exec_errors(t_data *data, t_exec *exec, int error_code);
 void	conversion_errors(t_data *data, t_exec *exec, int i);
 void	error_incorrect_path(t_data *data, t_exec *exec);
-void	redirections_errors(t_data *data, t_exec *exec, int std, int parent);
+int		redirections_errors(t_data *data, t_exec *exec, char *file,
+			int parent);
 
 #endif
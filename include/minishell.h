@@ -9,6 +9,12 @@ functionality without redundant includes.
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
+// Exposes Linux-specific APIs (e.g. pipe2(), F_SETPIPE_SZ); needs to be
+// defined before any system header is included.
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+
 # include "libft.h" // libft fcts, stdlib.h (malloc,..), unistd.h (e.g)
 
 # include "config.h" // configuration constants, like color codes or prompts
@@ -22,15 +28,21 @@ functionality without redundant includes.
 # include "builtins.h" // `cd`, `pwd`, `env`, `unset`, `export`, `echo` as fcts
 # include "execution.h" // exec commands and builtins, incl. piping and redir
 # include "signals.h" // signal handling in prompt, heredoc prompt, and exec
+# include "trace.h" // optional per-phase latency trace (MINISHELL_TRACE)
 
 # include <fcntl.h> // open, close, access, unlink
 # include <stdio.h> // perror, printf
 # include <errno.h> // errno
+# include <limits.h> // INT_MAX
 # include <sys/wait.h> // waitpid
+# include <sys/mman.h> // memfd_create
 # include <sys/ioctl.h> // ioctl(), TIOCSTI
+# include <sys/uio.h> // writev
 # include <readline/readline.h> // reading/editing input lines
 # include <readline/history.h> // tracking/accessing previous command lines
 # include <signal.h> // signal/sig fcts, kill
+# include <time.h> // clock_gettime
+# include <dirent.h> // opendir, readdir (globbing)
 
 /**
 Global variable used to indicate if the CTRL+C signal was received.
@@ -62,6 +74,7 @@ extern volatile __sig_atomic_t	g_signal;
 // 4: Custoum built-in fcts for our minishell -> see builtins.h
 // 5: Command exectuion (incl. forking / piping) -> see execution.h
 // 6: Signal handling -> see singals.h
+// 9: Per-phase latency trace and allocation accounting -> see trace.h
 
 // 7_utils/utils.c
 
@@ -71,6 +84,20 @@ void	set_path_to_file(t_data *data, char **str, char *file, char *err_msg);
 void	minishell_prompt(t_data *data);
 void	handle_g_signal(t_data *data);
 
+// 7_utils/input.c
+
+void	init_input(t_data *data);
+char	*read_script_line(t_data *data);
+void	sync_script_input(t_data *data);
+
+// 7_utils/env_utils.c
+
+char	*get_env_value(t_env *env, const char *var_name);
+int		set_env_var(t_data *data, const char *name, const char *value);
+t_env_slab	*get_env_slab(void);
+void	env_free(void *ptr);
+void	free_env_slab(void);
+
 // 7_utils/errors.c
 
 void	print_err_msg(char *msg);
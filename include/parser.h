@@ -1,8 +1,10 @@
 /**
 This header file defines functions for parsing and processing tokens generated
 by the tokenizer. It includes functionalities for handling various aspects of the
-shell's input, such as managing here-documents, performing variable expansions,
-and counting pipes.
+shell's input, such as managing here-documents, performing variable,
+parameter and arithmetic expansions and command substitution, counting pipes,
+and parsing command lines with control flow (`;`, `if`, `while`, `until`,
+`for`) into command lists.
 
 The parsing process prepares the tokens for execution by organizing and
 transforming them into a structured format suitable for further processing
@@ -23,8 +25,34 @@ int		parse_tokens(t_data *data);
 bool	process_quote(char ch, bool *in_single_quote, bool *in_double_quote);
 char	*trim_paired_quotes(const char *str);
 int		is_variable(char *str, int i);
+int		replace_range(char **str, int start, int end, const char *value);
+int		expand_nested(char **str, t_data *data);
 void	count_pipes(t_data *data, t_token *node);
 
+// 2_parser/parser_compound.c
+
+int		expect_word(t_data *data, t_list **cur, const char *word);
+int		parse_list(t_data *data, t_list **cur, t_node **list);
+
+// 2_parser/parser_compound_cmds.c
+
+int		parse_if(t_data *data, t_list **cur, t_node **node);
+int		parse_loop(t_data *data, t_list **cur, t_node **node);
+int		parse_for(t_data *data, t_list **cur, t_node **node);
+
+// 2_parser/parser_compound_utils.c
+
+t_node	*new_node(t_node_type type);
+void	free_nodes(t_node *node);
+int		is_reserved_word(t_list *cur, const char *word);
+int		is_list_end(t_list *cur);
+int		syntax_error(t_data *data, t_list *cur);
+
+// 2_parser/parser_program.c
+
+int		is_compound(t_data *data);
+int		parse_program(t_data *data);
+
 // 2_parser/parser_heredoc.c
 
 int		process_heredocs(t_data *data);
@@ -36,10 +64,108 @@ char	*get_heredoc(t_data *data);
 int		get_heredoc_fd(t_data *data);
 int		convert_tokens(t_data *data, t_token *curr_token, t_token *next_token);
 
+// 2_parser/parser_heredoc_collect.c
+
+int		collect_heredocs(t_data *data);
+char	*next_heredoc_line(t_data *data);
+
+// 2_parser/parser_heredoc_keep.c
+
+int		keep_heredocs(t_data *data, t_node *node);
+int		load_heredocs(t_data *data, t_node *node);
+
 // 2_parser/parser_var_expansion.c
 
 int		expand_variables(char **str, t_data *data, int expand_in_single_quotes);
 
+// 2_parser/parser_arith.c
+
+int		arith_end(const char *str, int i);
+int		expand_arithmetic(char **str, int *i, t_data *data);
+int		arith_eval(t_data *data, const char *expr, long *result);
+
+// 2_parser/parser_arith_eval.c
+
+long	arith_assign(t_arith *a);
+int		arith_eval_expr(t_arith *a, long *result);
+
+// 2_parser/parser_arith_operand.c
+
+long	arith_operand(t_arith *a);
+
+// 2_parser/parser_arith_ops.c
+
+int		arith_binary_op(t_arith *a, const char **op);
+int		arith_assign_op(t_arith *a, const char **op);
+long	arith_apply(t_arith *a, const char *op, long x, long y);
+
+// 2_parser/parser_arith_utils.c
+
+void	arith_skip_space(t_arith *a);
+long	arith_error(t_arith *a, const char *msg, int pos);
+char	*arith_read_name(t_arith *a);
+long	arith_get_var(t_arith *a, const char *name);
+void	arith_set_var(t_arith *a, const char *name, long value);
+
+// 2_parser/parser_subst.c
+
+int		paren_end(const char *str, int i);
+int		subst_end(const char *str, int i);
+int		expand_command(char **str, int *i, t_data *data);
+
+// 2_parser/parser_procsubst.c
+
+int		expand_procsubst(char **str, t_data *data);
+
+// 2_parser/parser_param.c
+
+int		param_end(const char *str, int i);
+int		expand_parameter(char **str, int *i, t_data *data);
+
+// 2_parser/parser_param_ops.c
+
+int		param_default(t_param *p);
+int		param_trim(t_param *p);
+int		param_substring(t_param *p);
+
+// 2_parser/parser_param_replace.c
+
+int		param_replace(t_param *p);
+
+// 2_parser/parser_param_utils.c
+
+int		param_error(t_param *p, const char *msg);
+int		param_word(t_param *p, const char *word, size_t len, char **out);
+int		param_pattern(t_param *p, const char *word, size_t len,
+			t_pattern **pat);
+int		param_arith(t_param *p, const char *word, size_t len, long *value);
+size_t	param_split(const char *word, char sep);
+
+// 2_parser/parser_pattern.c
+
+t_pattern	*pattern_compile(const char *word);
+void		pattern_free(t_pattern *pat);
+
+// 2_parser/parser_pattern_match.c
+
+int		pattern_elem_match(const t_pat_elem *elem, unsigned char c);
+int		pattern_match(const t_pattern *pat, const char *str, size_t len);
+
+// 2_parser/parser_pattern_affix.c
+
+ssize_t	pattern_match_prefix(const t_pattern *pat, const char *str, size_t len,
+			int longest);
+ssize_t	pattern_match_suffix(const t_pattern *pat, const char *str, size_t len,
+			int longest);
+
+// 2_parser/parser_glob.c
+
+int		expand_glob(t_data *data);
+
+// 2_parser/parser_glob_dir.c
+
+void	glob_dir(t_glob *g, size_t i);
+
 // 2_parser/parser_var_expansion_utils.c
 
 int		get_str_l(char **str, int i, char **substr_left);
@@ -20,16 +20,42 @@ int		get_tokens(t_data *data);
 t_list	*create_tok(t_data *data, t_token_type type, const char *lexeme,
 			int *i);
 
+// tokenizer_cache.c
+
+int		get_cached_tokens(t_data *data);
+void	free_parse_cache(t_parse_cache *cache);
+
+// tokenizer_cache_utils.c
+
+t_list			*copy_tokens(t_list *src, t_list *end);
+t_cache_entry	*get_lru_entry(t_parse_cache *cache);
+
+// tokenizer_keyword.c
+
+int		strip_time_keyword(t_data *data);
+
 // tokenizer_pipe.c
 
 int		is_pipe(t_data *data, int *i);
 
+// tokenizer_separator.c
+
+int		is_separator(t_data *data, int *i);
+
 // tokenizer_redirection.c
 
 int		is_redirection(t_data *data, int *i);
 
+// tokenizer_redirection_utils.c
+
+int		get_redirection_op(const char *s, t_token_type *type);
+int		is_redir_token(t_token_type type);
+
 // tokenizer_utils.c
 
-int		is_delimiter(t_data *data, const char c);
+int		skip_word(const char *input, int i);
+void	add_token(t_data *data);
+int		is_command_start(t_data *data);
+void	number_tokens(t_list *tokens);
 
 #endif
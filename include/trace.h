@@ -0,0 +1,45 @@
+/**
+This header file declares the functions of the per-phase latency trace:
+If enabled via the MINISHELL_TRACE environment variable, the time each
+command line spends in every phase (see `t_phase`) is measured with a
+monotonic clock and reported after the line, and a histogram per phase is
+reported when minishell exits.
+In a build with 'make MEMSTAT=1', the allocations are counted per phase as
+well (see memstat.c).
+*/
+
+#ifndef TRACE_H
+# define TRACE_H
+
+# include "types.h"
+
+// 9_trace/trace.c
+
+void			trace_init(t_data *data);
+void			trace_finish(t_data *data);
+
+// 9_trace/trace_time.c
+
+unsigned long	trace_now(t_data *data);
+void			trace_add(t_data *data, t_phase phase, unsigned long start);
+int				trace_call(t_data *data, t_phase phase, int (*f)(t_data *));
+void			trace_lap(t_data *data);
+void			trace_mark(t_data *data, t_phase phase, t_phase next);
+
+// 9_trace/memstat.c
+
+void			memstat_init(void);
+int				memstat_report(t_strbuf *sb);
+void			memstat_finish(void);
+
+// 9_trace/trace_report.c
+
+const char		*trace_phase_name(t_phase phase);
+void			trace_write(t_trace *trace, t_strbuf *sb, int ok);
+void			trace_line_end(t_data *data, unsigned long start);
+
+// 9_trace/trace_summary.c
+
+void			trace_summary(t_data *data);
+
+#endif
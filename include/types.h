@@ -12,6 +12,8 @@ including user input, token and built-in management, and environment variables.
 
 # include "libft.h" // t_list
 # include <stdbool.h> // bool
+# include <time.h> // struct timespec
+# include <sys/resource.h> // struct rusage
 
 //	++++++++++++
 //	++ TOKENS ++
@@ -23,10 +25,24 @@ Categorizes tokens:
 
 - PIPE :		'|' ; pipeline between two commands.
 - REDIR_IN:		'<'	; redirects input of a command from a file instead of STDIN.
-- REDIR_OUT:	'>' ; redirects output of a command into file instead of STDOUT.
-- REDIR_APPEND:	'>>'; appends cmd output to a file without truncating it.
+- REDIR_OUT:	'>' ; redirects output of a command into file instead of STDOUT
+				(also '>|', as there is no 'noclobber' option).
+- APPEND_OUT:	'>>'; appends cmd output to a file without truncating it.
 - HEREDOC :		'<<'; creates a here-document, directly input via CL.
+- HERESTRING:	'<<<'; passes a single (expanded) word as input, followed by
+				a newline.
+- REDIR_RW:		'<>'; opens a file for reading and writing (as STDIN).
+- DUP_IN:		'<&'; duplicates an input fd ('<&0'), or closes it ('<&-').
+- DUP_OUT:		'>&'; duplicates an output fd ('2>&1'), or closes it ('>&-').
+- ALL_OUT:		'&>'; redirects both STDOUT and STDERR into a file.
+- ALL_APPEND:	'&>>'; appends both STDOUT and STDERR to a file.
+- SEPARATOR:	';' or a newline; separates two commands of a list (see
+				parser_compound.c).
 - OTHER :		All other types.
+
+All redirection operators except '&>' and '&>>' can be prefixed with the fd
+they apply to (e.g. '2>', '3<', '2>>', '2>&1'); the number is part of the
+token's lexeme.
 */
 typedef enum e_token_type
 {
@@ -35,6 +51,13 @@ typedef enum e_token_type
 	REDIR_OUT,
 	APPEND_OUT,
 	HEREDOC,
+	HERESTRING,
+	REDIR_RW,
+	DUP_IN,
+	DUP_OUT,
+	ALL_OUT,
+	ALL_APPEND,
+	SEPARATOR,
 	OTHER,
 }	t_token_type;
 
@@ -68,6 +91,8 @@ Fields:
 						created from the current token.
 - tok_lst [t_list*]:	Pointer to the head of the linked list of tokens, which
 						stores all tokens parsed from the input.
+- tok_last [t_list*]:	Pointer to the last node of the token list, used to
+						append new tokens.
 - curr_node [t_list*]:	Initialized with 'data->tok.tok_lst' and then updated to
 						iterate the linked list (curr_node = curr_node->next).
 - curr_tok [t_tok*]:	The content of the current node, contains lexem and type.
@@ -76,6 +101,8 @@ Fields:
 - r_redir [int]:		Holds the return value of `is_redirection()` in
 						`get_tokens()`.
 - r_pipe [int]:			Holds the return value of `is_pipe()` in `get_tokens()`.
+- r_sep [int]:			Holds the return value of `is_separator()` in
+						`get_tokens()`.
 - r_other [int]:		Holds the return value of `add_other_token` in
 						`get_tokens()`.
 */
@@ -84,16 +111,56 @@ typedef struct s_tok
 	t_token	*tok;
 	t_list	*new_node;
 	t_list	*tok_lst;
+	t_list	*tok_last;
 	t_list	*curr_node;
 	t_token	*curr_tok;
 	t_token	*next_tok;
 	char	*tmp;
-	char	quote;
 	int		r_redir;
 	int		r_pipe;
+	int		r_sep;
 	int		r_other;
 }	t_tok;
 
+/**
+A command line in the parse cache (see tokenizer_cache.c).
+
+Fields:
+- input [char*]:		The command line, as entered.
+- len [size_t]:			Its length.
+- tokens [t_list*]:		The tokens it was split into, before any heredoc,
+						expansion or quote removal was applied.
+- used [unsigned long]:	When the entry was used last (see `clock`), to find
+						the least recently used one.
+*/
+typedef struct s_cache_entry
+{
+	char			*input;
+	size_t			len;
+	t_list			*tokens;
+	unsigned long	used;
+}	t_cache_entry;
+
+/**
+Caches the tokens of the last PARSE_CACHE_SIZE distinct command lines, so a
+repeated line is neither checked for quotes nor tokenized again.
+
+Fields:
+- entries [t_cache_entry[]]:	The cached lines, unused ones have no `input`.
+- clock [unsigned long]:		Incremented on every use of an entry.
+- hits [unsigned long]:			Number of lines found in the cache.
+- misses [unsigned long]:		Number of lines that had to be tokenized.
+- hit [int]:					Index of the entry found for the current line.
+*/
+typedef struct s_parse_cache
+{
+	t_cache_entry	entries[PARSE_CACHE_SIZE];
+	unsigned long	clock;
+	unsigned long	hits;
+	unsigned long	misses;
+	int				hit;
+}	t_parse_cache;
+
 //	+++++++++++++
 //	++ PARSING ++
 //	+++++++++++++
@@ -116,6 +183,54 @@ typedef struct s_quote
 	bool	in_double;
 }	t_quote;
 
+/**
+The kinds of commands in a command list (see parser_compound.c):
+ - `NODE_CMD`:		A pipeline of simple commands.
+ - `NODE_IF`:		`if` cond `then` body [`elif` ... | `else` other] `fi`
+ - `NODE_WHILE`:	`while` cond `do` body `done`
+ - `NODE_UNTIL`:	`until` cond `do` body `done`
+ - `NODE_FOR`:		`for` name [`in` words] `do` body `done`
+*/
+typedef enum e_node_type
+{
+	NODE_CMD,
+	NODE_IF,
+	NODE_WHILE,
+	NODE_UNTIL,
+	NODE_FOR,
+}	t_node_type;
+
+/**
+A command of a command list, parsed once and executed as often as needed:
+The tokens are kept as they were before heredocs, expansion and quote
+removal, which are applied to a copy of them on every execution.
+
+Fields:
+- type [t_node_type]:	The kind of command.
+- tokens [t_list*]:		`NODE_CMD`: the tokens of the pipeline (positions
+						starting at `0`). `NODE_FOR`: the words to iterate.
+- name [char*]:			`NODE_FOR`: the name of the loop variable.
+- heredocs [t_list*]:	`NODE_CMD`: the unexpanded lines of the bodies of
+						its heredocs, each ending with its delimiter.
+- cond [t_node*]:		`NODE_IF`, `NODE_WHILE`, `NODE_UNTIL`: the list whose
+						exit status decides.
+- body [t_node*]:		The list run if the condition is met, or per iteration.
+- other [t_node*]:		`NODE_IF`: the `else` list (an `elif` is a nested
+						`NODE_IF`).
+- next [t_node*]:		The next command of the list.
+*/
+typedef struct s_node
+{
+	t_node_type		type;
+	t_list			*tokens;
+	char			*name;
+	t_list			*heredocs;
+	struct s_node	*cond;
+	struct s_node	*body;
+	struct s_node	*other;
+	struct s_node	*next;
+}	t_node;
+
 //	+++++++++++++++
 //	++ BUILT-INS ++
 //	+++++++++++++++
@@ -133,9 +248,24 @@ typedef struct s_env
 	char			*e_var;
 	struct s_env	*next;
 	struct s_env	*previous;
-	bool			printed;
 }	t_env;
 
+/**
+The environment imported at startup (see init_env.c): A single allocation
+holding the nodes of the envp_temp and export lists and one copy of every
+string, which the nodes of both lists share. Nodes and strings inside of it
+are never freed on their own (see env_free()).
+- start [char*]:		The allocation, `NULL` if the environment was empty.
+- size [size_t]:		Its size in bytes.
+- count [size_t]:		The number of imported variables.
+*/
+typedef struct s_env_slab
+{
+	char	*start;
+	size_t	size;
+	size_t	count;
+}	t_env_slab;
+
 //	+++++++++++++++
 //	++ EXECUTION ++
 //	+++++++++++++++
@@ -145,30 +275,123 @@ typedef struct s_child
 	pid_t	*nbr;
 }	t_child;
 
+/*One redirection of a command: 'fd' is the file descriptor being redirected
+(e.g. 2 in '2>file'), 'type' the redirection operator and 'target' the file
+name, or the fd number / '-' for DUP_IN and DUP_OUT.*/
+typedef struct s_redir
+{
+	int				fd;
+	t_token_type	type;
+	char			*target;
+}	t_redir;
+
 typedef struct s_exec
 {
-	int		pipe_fd[2];
-	int		prev_pipe_fd[2];
-	int		infile_fd;
-	int		outfile_fd;
-	int		curr_child;
-	int		count_flags;
-	char	**envp_temp_arr;
-	char	**all_paths;
-	char	*current_path;
-	char	**input;
-	char	*cmd;
-	char	**flags;
-	char	*infile;
-	char	*outfile;
-	bool	redir_in;
-	bool	redir_out;
-	bool	append_out;
-	bool	first;
-	bool	cmd_found;
-	t_child	*child;
+	int			*pipes;
+	t_list		*redirs;
+	int			curr_child;
+	int			count_flags;
+	char		**envp_temp_arr;
+	char		**all_paths;
+	char		*current_path;
+	char		**input;
+	char		*cmd;
+	char		**flags;
+	bool		first;
+	bool		cmd_found;
+	t_child		*child;
+	t_strbuf	out;
+	t_strbuf	*capture;
 }	t_exec;
 
+/*A process substitution, '<(cmd)' or '>(cmd)' (see execution_procsubst.c):
+'dir' is '<' or '>', 'fd' the shell's end of the pipe (close-on-exec and at
+most PROCSUBST_FD_MAX), which the command accesses as /dev/fd/<fd>, and
+'pid' the subshell running 'cmd' (0 if there is none, as 'cmd' is empty).*/
+typedef struct s_procsubst
+{
+	char	dir;
+	int		fd;
+	pid_t	pid;
+}	t_procsubst;
+
+//	++++++++++++
+//	++ TIMING ++
+//	++++++++++++
+
+/**
+State of the reserved word `time` (see time.c).
+- active [bool]:				The current command line is being timed.
+- start [struct timespec]:		When the command line started.
+- self [struct rusage]:			The shell's own resource usage at the start.
+- children [struct rusage]:		The resource usage of all stages of the
+								pipeline, added up by finish_children().
+*/
+typedef struct s_timing
+{
+	bool			active;
+	struct timespec	start;
+	struct rusage	self;
+	struct rusage	children;
+}	t_timing;
+
+//	+++++++++++
+//	++ TRACE ++
+//	+++++++++++
+
+/**
+The phases of processing a command line, measured by the latency trace.
+ - `PH_QUOTES`:		Checking for unclosed quotes.
+ - `PH_TOKENS`:		Tokenization.
+ - `PH_HEREDOCS`:	Reading heredocs.
+ - `PH_EXPANSION`:	Variable expansion and quote removal.
+ - `PH_PLAN`:		Preparing the execution (exec struct, pipes, here-strings).
+ - `PH_FORK`:		Creating the child processes.
+ - `PH_EXEC`:		Running a builtin in the parent, or in each child: the
+					time from fork() until execve() (or the builtin's end),
+					summed up over all children.
+ - `PH_WAIT`:		Waiting for the children to finish.
+ - `PH_TOTAL`:		The whole command line.
+ - `PH_OTHER`:		Everything outside of the phases above (prompt, history,
+					startup). Only used to count allocations (see memstat.c).
+*/
+typedef enum e_phase
+{
+	PH_QUOTES,
+	PH_TOKENS,
+	PH_HEREDOCS,
+	PH_EXPANSION,
+	PH_PLAN,
+	PH_FORK,
+	PH_EXEC,
+	PH_WAIT,
+	PH_TOTAL,
+	PH_OTHER,
+	PH_COUNT
+}	t_phase;
+
+/**
+State of the latency trace. It lives in memory shared with all child
+processes, so they can add the time they spend before execve().
+- owner [pid_t]:			The shell process (which prints the reports).
+- fd [int]:					Where the reports are written to.
+- lap [unsigned long]:		Start of the current phase (see trace_mark()).
+- lines [unsigned long]:	Number of command lines traced.
+- line_ns [unsigned long[]]:	Time spent in each phase of the current line.
+- hist [unsigned long[][]]:	Per phase, the number of lines by duration:
+								bucket 0 counts durations below 1 us, bucket
+								k those below 2^k us.
+*/
+typedef struct s_trace
+{
+	pid_t			owner;
+	int				fd;
+	unsigned long	lap;
+	unsigned long	lines;
+	unsigned long	line_ns[PH_COUNT];
+	unsigned long	hist[PH_COUNT][TRACE_BUCKETS];
+}	t_trace;
+
 //	+++++++++++++++++
 //	++ DATA STRUCT ++
 //	+++++++++++++++++
@@ -190,6 +413,7 @@ Fields:
 - exit_status [unsigned int]:	The exit status of the last executed command.
 - working_dir [char *]:	The project's working directory.
 - tok [t_tok]:			Manages token status and holds the linked list of tokens.
+- cache [t_parse_cache]:	The tokens of recently entered command lines.
 - envp_temp [t_env*]:	A linked list containing the continuously modified state
 						of the environment variables, used for the "env" command.
 - export_list [t_env*]:	A linked list containing the continuously modified state
@@ -198,6 +422,20 @@ Fields:
 						'export' command.
 - cd [t_cd]:			Used for the "cd" built-in command.
 - quote [t_quote]		Parsing context is inside single or double quotes.
+- interactive [bool]:	Whether the input is read from a terminal (readline,
+						prompt, history) or from a script or pipe.
+- script [t_gnl_reader]:	Reads the script or standard input line by line if
+							not interactive.
+- program [t_node*]:	The command list of the current line, if it contains
+						control flow (see parser_program.c), otherwise `NULL`.
+- trace [t_trace*]:		The latency trace, `NULL` if not enabled.
+- timing [t_timing]:	Timing of a command line prefixed with `time`.
+- procsubst [t_list*]:	The process substitutions of the current command
+						(`t_procsubst`), finished after it.
+- heredoc_lines [t_list*]:	Lines of heredoc bodies read ahead within a
+							command list (see parser_heredoc_collect.c), or
+							of the command being executed (see
+							parser_heredoc_keep.c).
 */
 typedef struct s_data
 {
@@ -210,10 +448,153 @@ typedef struct s_data
 	char			*working_dir;
 	char			*path_to_hist_file;
 	t_tok			tok;
+	t_parse_cache	cache;
 	t_env			*envp_temp;
 	t_env			*export_list;
 	t_cd			cd;
 	t_quote			quote;
+	bool			interactive;
+	t_gnl_reader	script;
+	t_node			*program;
+	t_trace			*trace;
+	t_timing		timing;
+	t_list			*procsubst;
+	t_list			*heredoc_lines;
 }	t_data;
 
+/**
+The state of the evaluation of an arithmetic expression (see
+parser_arith_eval.c), as in `$(( expr ))` and `let`.
+
+Fields:
+- data [t_data*]:		Pointer to the data struct (variables, exit status).
+- expr [const char*]:	The expression.
+- pos [int]:			The index of the next character to read.
+- tok [int]:			The index of the last operand read, reported as the
+						token causing an error (e.g. the `0` of `1 / 0`).
+- noeval [int]:			If not `0`, the expression is only parsed, without
+						assigning variables or reporting division by 0 (e.g.
+						the right side of `0 && x = 1`).
+- error [int]:			Set once an error was reported; the evaluation stops.
+- depth [int]:			How deep the values of variables used in expressions
+						are nested (they are expressions themselves).
+*/
+typedef struct s_arith
+{
+	t_data		*data;
+	const char	*expr;
+	int			pos;
+	int			tok;
+	int			noeval;
+	int			error;
+	int			depth;
+}	t_arith;
+
+/**
+The kinds of elements of a compiled glob pattern (see parser_pattern.c):
+ - `PAT_CHAR`:	A literal character (e.g. a quoted `*`).
+ - `PAT_ANY`:	`?`, any single character.
+ - `PAT_STAR`:	`*`, any string (consecutive ones are merged).
+ - `PAT_CLASS`:	A bracket expression like `[a-z]` or `[!0-9]`.
+*/
+typedef enum e_pat_type
+{
+	PAT_CHAR,
+	PAT_ANY,
+	PAT_STAR,
+	PAT_CLASS,
+}	t_pat_type;
+
+/**
+An element of a compiled glob pattern.
+
+Fields:
+- type [t_pat_type]:	The kind of element.
+- c [unsigned char]:	`PAT_CHAR`: the character.
+- set [unsigned char[32]]:	`PAT_CLASS`: a bitmap of the characters in the
+							class (already inverted for `[!...]`), so
+							matching a character is a single lookup.
+*/
+typedef struct s_pat_elem
+{
+	t_pat_type		type;
+	unsigned char	c;
+	unsigned char	set[32];
+}	t_pat_elem;
+
+/**
+A glob pattern, compiled once so that it can be matched against many
+strings without parsing it again (quotes and bracket expressions).
+
+Fields:
+- elems [t_pat_elem*]:	The elements of the pattern, allocated along with
+						the struct, behind it.
+- count [size_t]:		The number of elements.
+- magic [bool]:			Whether the pattern contains any `*`, `?` or
+						bracket expression, i.e. can match anything other
+						than itself.
+- states [unsigned char*]:	Two sets of `count + 1` states, used to match
+							beginnings and ends (see parser_pattern_affix.c),
+							behind `elems`.
+*/
+typedef struct s_pattern
+{
+	t_pat_elem		*elems;
+	size_t			count;
+	bool			magic;
+	unsigned char	*states;
+}	t_pattern;
+
+/**
+A pathname expansion being evaluated (see parser_glob.c).
+
+Fields:
+- pats [t_pattern**]:	The compiled patterns of the components of the word
+						(separated by `/`), each compiled once for the whole
+						scan.
+- count [size_t]:		The number of components.
+- magic [bool]:			Whether any component is a pattern.
+- path [t_strbuf]:		The path built so far; a directory ends with `/`,
+						the current directory is empty.
+- matches [t_list*]:	The matching paths found so far (as tokens).
+- found [size_t]:		The number of matches.
+- error [bool]:			Set on malloc failure; the scan stops.
+*/
+typedef struct s_glob
+{
+	t_pattern	**pats;
+	size_t		count;
+	bool		magic;
+	t_strbuf	path;
+	t_list		*matches;
+	size_t		found;
+	bool		error;
+}	t_glob;
+
+/**
+A parameter expansion `${...}` being evaluated (see parser_param.c).
+
+Fields:
+- data [t_data*]:		Pointer to the data struct.
+- expr [char*]:			The text between the braces, e.g. `NAME:-word`.
+- name [char*]:			The name of the parameter.
+- value [char*]:		A copy of its value (empty if unset).
+- is_set [bool]:		Whether the parameter is set.
+- length [bool]:		Whether it is `${#NAME}`.
+- op [char*]:			The operator following the name in `expr`, e.g.
+						`:-word` (an empty string if there is none).
+- result [char*]:		The result of the expansion.
+*/
+typedef struct s_param
+{
+	t_data	*data;
+	char	*expr;
+	char	*name;
+	char	*value;
+	bool	is_set;
+	bool	length;
+	char	*op;
+	char	*result;
+}	t_param;
+
 #endif
@@ -0,0 +1,265 @@
+/*
+Micro-benchmark for the block-wise string/memory kernels of libft (see
+ft_simd.h): Compares ft_strlen, ft_memchr, ft_strchr, ft_memcpy, ft_strcmp
+and ft_strcspn with the former byte-by-byte versions (copied below as 'ref_*')
+and glibc, across string lengths. Before timing, the kernels are checked against glibc
+for all alignments and lengths up to 3 blocks.
+
+Built and run via 'make bench' in libft/. Prints one line per kernel and
+length: ns/op for the reference loop, libft and glibc.
+*/
+
+#include "../libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LEN		16384
+#define TOTAL_BYTES	(1 << 26)
+
+typedef long	(*t_run)(int impl, char *a, char *b, size_t len);
+
+static size_t	ref_strlen(const char *str)
+{
+	size_t	i;
+
+	i = 0;
+	while (str[i])
+		i++;
+	return (i);
+}
+
+static void	*ref_memchr(const void *s, int c, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (((unsigned char *)s)[i] == (unsigned char)c)
+			return ((void *)((const unsigned char *)s + i));
+		i++;
+	}
+	return (NULL);
+}
+
+static char	*ref_strchr(const char *s, int c)
+{
+	while (*s != '\0')
+	{
+		if (*s == (char)c)
+			return ((char *)s);
+		s++;
+	}
+	if (*s == (char)c)
+		return ((char *)s);
+	return (NULL);
+}
+
+static void	*ref_memcpy(void *dest, const void *src, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		((char *)dest)[i] = ((const char *)src)[i];
+		i++;
+	}
+	return (dest);
+}
+
+static size_t	ref_strcspn(const char *s, const char *reject)
+{
+	size_t	i;
+
+	i = 0;
+	while (!ref_strchr(reject, s[i]))
+		i++;
+	return (i);
+}
+
+static int	ref_strcmp(const char *s1, const char *s2)
+{
+	size_t	i;
+
+	i = 0;
+	while (s1[i] && s2[i] && s1[i] == s2[i])
+		i++;
+	return ((unsigned char)s1[i] - (unsigned char)s2[i]);
+}
+
+// Called through volatile pointers, so the compiler can't inline or fold them
+static size_t (*volatile g_strlen[3])(const char *)
+	= {ref_strlen, ft_strlen, strlen};
+static void *(*volatile g_memchr[3])(const void *, int, size_t)
+	= {ref_memchr, ft_memchr, memchr};
+static char *(*volatile g_strchr[3])(const char *, int)
+	= {ref_strchr, ft_strchr, strchr};
+static void *(*volatile g_memcpy[3])(void *, const void *, size_t)
+	= {ref_memcpy, ft_memcpy, memcpy};
+static int (*volatile g_strcmp[3])(const char *, const char *)
+	= {ref_strcmp, ft_strcmp, strcmp};
+static size_t (*volatile g_strcspn[3])(const char *, const char *)
+	= {ref_strcspn, ft_strcspn, strcspn};
+
+// a: 'len' times 'a' followed by NUL, b: copy of a
+static long	run_strlen(int impl, char *a, char *b, size_t len)
+{
+	(void)b;
+	(void)len;
+	return ((long)g_strlen[impl](a));
+}
+
+static long	run_memchr(int impl, char *a, char *b, size_t len)
+{
+	(void)b;
+	return ((long)g_memchr[impl](a, '\0', len + 1));
+}
+
+static long	run_strchr(int impl, char *a, char *b, size_t len)
+{
+	(void)b;
+	(void)len;
+	return ((long)g_strchr[impl](a, '\0'));
+}
+
+static long	run_memcpy(int impl, char *a, char *b, size_t len)
+{
+	return ((long)g_memcpy[impl](b, a, len));
+}
+
+static long	run_strcmp(int impl, char *a, char *b, size_t len)
+{
+	(void)len;
+	return (g_strcmp[impl](a, b));
+}
+
+// The set of word delimiters and quotes, as used by the tokenizer
+static long	run_strcspn(int impl, char *a, char *b, size_t len)
+{
+	(void)b;
+	(void)len;
+	return ((long)g_strcspn[impl](a, " \t\n\v\f\r<>|'\""));
+}
+
+static int	sign(long x)
+{
+	return ((x > 0) - (x < 0));
+}
+
+/*
+Checks ft_* against glibc for all alignments of both strings and all lengths
+up to 3 blocks, including a difference / match at every position.
+Returns the number of mismatches.
+*/
+static int	verify(char *a, char *b)
+{
+	size_t	off;
+	size_t	len;
+	size_t	pos;
+	int		errors;
+
+	errors = 0;
+	off = 0;
+	while (off < 32)
+	{
+		len = 0;
+		while (len < 48)
+		{
+			memset(a, 'a', 128);
+			a[off + len] = '\0';
+			errors += (ft_strlen(a + off) != len);
+			errors += (ft_strchr(a + off, '\0') != strchr(a + off, '\0'));
+			errors += (ft_memchr(a + off, 'x', len) != NULL);
+			errors += (ft_strcspn(a + off, "xyz|") != len);
+			pos = 0;
+			while (pos < len)
+			{
+				a[off + pos] = 'x';
+				errors += (ft_strchr(a + off, 'x') != a + off + pos);
+				errors += (ft_memchr(a + off, 'x', len) != a + off + pos);
+				errors += (ft_memchr(a + off, 'x', pos) != NULL);
+				errors += (ft_strcspn(a + off, "|x") != pos);
+				memcpy(b + 3, a + off, len + 1);
+				errors += (sign(ft_strcmp(a + off, b + 3))
+						!= sign(strcmp(a + off, b + 3)));
+				b[3 + pos] = 'y';
+				errors += (sign(ft_strcmp(a + off, b + 3))
+						!= sign(strcmp(a + off, b + 3)));
+				a[off + pos] = 'a';
+				pos++;
+			}
+			memset(b, 0, 128);
+			ft_memcpy(b + (off % 7), a + off, len);
+			errors += (memcmp(b + (off % 7), a + off, len) != 0);
+			len++;
+		}
+		off++;
+	}
+	return (errors);
+}
+
+static double	time_op(t_run run, int impl, size_t len, char **bufs)
+{
+	struct timespec	start;
+	struct timespec	end;
+	long			iters;
+	long			i;
+	volatile long	sink;
+
+	iters = TOTAL_BYTES / (len + 16);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	i = 0;
+	while (i < iters)
+	{
+		sink = run(impl, bufs[0], bufs[1], len);
+		i++;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	(void)sink;
+	return (((end.tv_sec - start.tv_sec) * 1e9
+			+ (end.tv_nsec - start.tv_nsec)) / iters);
+}
+
+static void	bench(const char *name, t_run run, char **bufs)
+{
+	static const size_t	lens[] = {1, 8, 32, 128, 1024, MAX_LEN - 1};
+	size_t				i;
+
+	i = 0;
+	while (i < sizeof(lens) / sizeof(lens[0]))
+	{
+		memset(bufs[0], 'a', lens[i]);
+		bufs[0][lens[i]] = '\0';
+		memcpy(bufs[1], bufs[0], lens[i] + 1);
+		printf("%-10s %6zu %12.2f %12.2f %12.2f\n", name, lens[i],
+			time_op(run, 0, lens[i], bufs), time_op(run, 1, lens[i], bufs),
+			time_op(run, 2, lens[i], bufs));
+		i++;
+	}
+}
+
+int	main(void)
+{
+	char	*bufs[2];
+	int		errors;
+
+	bufs[0] = malloc(MAX_LEN + 1);
+	bufs[1] = malloc(MAX_LEN + 1);
+	if (!bufs[0] || !bufs[1])
+		return (1);
+	errors = verify(bufs[0], bufs[1]);
+	printf("verify: %s (%d mismatches)\n\n", errors ? "FAILED" : "ok", errors);
+	printf("%-10s %6s %12s %12s %12s\n", "kernel", "len", "ref ns/op",
+		"libft ns/op", "glibc ns/op");
+	bench("strlen", run_strlen, bufs);
+	bench("memchr", run_memchr, bufs);
+	bench("strchr", run_strchr, bufs);
+	bench("memcpy", run_memcpy, bufs);
+	bench("strcmp", run_strcmp, bufs);
+	bench("strcspn", run_strcspn, bufs);
+	free(bufs[0]);
+	free(bufs[1]);
+	return (errors != 0);
+}
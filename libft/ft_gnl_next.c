@@ -0,0 +1,100 @@
+#include "libft.h"
+
+/*
+Doubles the size of the buffer, once a single line fills all of it.
+*/
+static int	grow(t_gnl_reader *r)
+{
+	char	*buf;
+
+	buf = malloc(r->cap * 2 + 1);
+	if (!buf)
+		return (0);
+	ft_memcpy(buf, r->buf, r->end);
+	free(r->buf);
+	r->buf = buf;
+	r->cap *= 2;
+	return (1);
+}
+
+/*
+Reads more data into the buffer. If it is full, the unreturned data is first
+moved to its front, and the buffer only grows if that doesn't free any space.
+
+Returns 1 on success (or at the end of the input, which sets r->eof) and -1
+on read or malloc failure.
+*/
+static int	fill(t_gnl_reader *r)
+{
+	ssize_t	n;
+	size_t	size;
+
+	if (r->end == r->cap && r->start > 0)
+	{
+		ft_memmove(r->buf, r->buf + r->start, r->end - r->start);
+		r->end -= r->start;
+		r->scan -= r->start;
+		r->start = 0;
+	}
+	if (r->end == r->cap && !grow(r))
+		return (-1);
+	size = r->cap - r->end;
+	if (size > r->chunk)
+		size = r->chunk;
+	n = read(r->fd, r->buf + r->end, size);
+	while (n == -1 && errno == EINTR)
+		n = read(r->fd, r->buf + r->end, size);
+	if (n == -1)
+		return (-1);
+	r->eof = (n == 0);
+	r->end += n;
+	return (1);
+}
+
+/*
+Returns the bytes from the start of the unreturned data up to 'stop' (the
+position of the '\n', or the end of the input) as the next line, terminating
+it in place.
+*/
+static int	take_line(t_gnl_reader *r, size_t stop, const char **line,
+	size_t *len)
+{
+	*line = r->buf + r->start;
+	*len = stop - r->start;
+	r->buf[stop] = '\0';
+	r->start = stop;
+	if (stop < r->end)
+		r->start++;
+	r->scan = r->start;
+	return (1);
+}
+
+/*
+Reads the next line. On success, *line points to it (NUL-terminated, without
+the '\n') inside the reader's buffer, and *len is its length. The line stays
+valid until the next call on the same reader, so it has to be copied to be
+kept. The last line of the input doesn't need to end with a '\n'.
+As the part of the buffer that was already searched for a '\n' is skipped,
+reading a line only takes linear time, however long it is.
+
+Returns 1 if a line was read, 0 at the end of the input and -1 on read or
+malloc failure.
+*/
+int	ft_gnl_next(t_gnl_reader *r, const char **line, size_t *len)
+{
+	char	*nl;
+
+	while (1)
+	{
+		nl = ft_memchr(r->buf + r->scan, '\n', r->end - r->scan);
+		if (nl)
+			return (take_line(r, nl - r->buf, line, len));
+		r->scan = r->end;
+		if (r->eof && r->start == r->end)
+			return (0);
+		if (r->eof)
+			return (take_line(r, r->end, line, len));
+		if (fill(r) == -1)
+			return (-1);
+	}
+}
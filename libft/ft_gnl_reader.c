@@ -0,0 +1,82 @@
+/*
+The gnl_reader is a variant of get_next_line() for reading large inputs line
+by line, e.g. the history file or a script: Instead of allocating a small
+buffer on every call and joining it onto the previous data, each reader owns
+one large buffer (GNL_READER_SIZE), which is refilled in place. Lines are
+returned as views into that buffer, so they are not copied at all; the buffer
+only grows (doubling its size) when a single line doesn't fit into it.
+
+	t_gnl_reader	r;
+	const char		*line;
+	size_t			len;
+
+	if (!ft_gnl_open(&r, fd, GNL_READER_SIZE))
+		return (error);
+	while (ft_gnl_next(&r, &line, &len) == 1)
+		use(line, len);
+	ft_gnl_close(&r);
+
+The buffer is owned by the caller's t_gnl_reader, so any number of fds can be
+read at the same time, without any static state.
+*/
+
+#include "libft.h"
+
+/*
+Initializes a reader for fd and allocates its buffer.
+
+'chunk' limits how many bytes are read from fd at once: GNL_READER_SIZE for
+files, 1 to never read past the end of the current line (e.g. if other
+processes continue reading from the same pipe afterwards).
+
+Returns 1 on success, 0 on malloc failure.
+*/
+int	ft_gnl_open(t_gnl_reader *r, int fd, size_t chunk)
+{
+	r->fd = fd;
+	r->cap = GNL_READER_SIZE;
+	r->start = 0;
+	r->scan = 0;
+	r->end = 0;
+	r->chunk = chunk;
+	r->eof = 0;
+	r->buf = malloc(r->cap + 1);
+	return (r->buf != NULL);
+}
+
+/*
+Frees the reader's buffer. The fd itself is not closed.
+*/
+void	ft_gnl_close(t_gnl_reader *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+	r->start = 0;
+	r->scan = 0;
+	r->end = 0;
+}
+
+/*
+Gives the data that was read into the buffer, but not returned as a line yet,
+back to the fd: It moves the fd's offset back to the end of the last line
+returned and empties the buffer. This only works for seekable fds (regular
+files), and is needed before other processes continue reading from the same
+open file.
+
+Returns 0 on success, -1 if the fd is not seekable.
+*/
+int	ft_gnl_sync(t_gnl_reader *r)
+{
+	off_t	unread;
+
+	unread = r->end - r->start;
+	r->start = 0;
+	r->scan = 0;
+	r->end = 0;
+	r->eof = 0;
+	if (unread == 0)
+		return (0);
+	if (lseek(r->fd, -unread, SEEK_CUR) == -1)
+		return (-1);
+	return (0);
+}
@@ -1,4 +1,5 @@
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 The memchr() function operates similarly to strchr(), with the distinction that
@@ -18,6 +19,43 @@ contingent on the compiler and platform. In contexts involving raw memory or
 byte-wise operations, treating characters as unsigned is a common practice to
 prevent unforeseen issues that may arise during value comparisons.
 */
+#ifndef FT_NO_BLOCKS
+
+/*
+Searches block by block (see ft_simd.h). The search starts at the aligned
+block containing s, with the bytes in front of s skipped in its mask; 'n' is
+then counted from the start of that block. A match past the n bytes (in the
+last block) is ignored.
+*/
+void	*ft_memchr(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	t_block				needle;
+	t_mask				mask;
+	size_t				i;
+
+	if (n == 0)
+		return (NULL);
+	i = (uintptr_t)s % FT_BLOCK;
+	p = (const unsigned char *)s - i;
+	if (n > SIZE_MAX - i)
+		n = SIZE_MAX - i;
+	n += i;
+	needle = ft_splat((unsigned char)c);
+	mask = ft_skip(ft_eq_mask(ft_load(p), needle), i);
+	while (!mask && n > FT_BLOCK)
+	{
+		p += FT_BLOCK;
+		n -= FT_BLOCK;
+		mask = ft_eq_mask(ft_load(p), needle);
+	}
+	if (!mask || ft_first(mask) >= n)
+		return (NULL);
+	return ((void *)(p + ft_first(mask)));
+}
+
+#else
+
 void	*ft_memchr(const void *s, int c, size_t n)
 {
 	size_t	i;
@@ -32,6 +70,8 @@ void	*ft_memchr(const void *s, int c, size_t n)
 	return (NULL);
 }
 
+#endif
+
 /*
 #include <stdio.h>
 #include <string.h>
@@ -1,4 +1,5 @@
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 The memcpy function efficiently copies up to 'n' bytes from the source (src) to
@@ -6,7 +7,42 @@ the destination (dst). This function operates similarly to strcpy, yet
 distinguishes itself by accepting void * as parameters. Consequently, memcpy()
 accommodates copying of data pointed to by any type of pointer, offering a
 versatile and adaptable copying mechanism.
+
+The bytes are copied a whole block (see ft_simd.h) at a time, only the
+remaining bytes at the end are copied one by one.
+*/
+#ifndef FT_NO_BLOCKS
+
+/*
+Used in ft_memcpy().
+
+Copies as many whole blocks as fit into n bytes, returns the bytes copied.
 */
+static size_t	copy_blocks(char *dest, const char *src, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (n - i >= FT_BLOCK)
+	{
+		ft_storeu(dest + i, ft_loadu(src + i));
+		i += FT_BLOCK;
+	}
+	return (i);
+}
+
+#else
+
+static size_t	copy_blocks(char *dest, const char *src, size_t n)
+{
+	(void)dest;
+	(void)src;
+	(void)n;
+	return (0);
+}
+
+#endif
+
 void	*ft_memcpy(void *dest, const void *src, size_t n)
 {
 	size_t		i;
@@ -15,9 +51,9 @@ void	*ft_memcpy(void *dest, const void *src, size_t n)
 
 	char_dest = (char *) dest;
 	char_src = (const char *) src;
-	i = 0;
 	if (dest == NULL && src == NULL)
 		return (NULL);
+	i = copy_blocks(char_dest, char_src, n);
 	while (i < n)
 	{
 		char_dest[i] = char_src[i];
@@ -0,0 +1,92 @@
+/*
+Allocation accounting for profiling and leak hunting: In a build with MEMSTAT
+defined ('make MEMSTAT=1'), libft.h redirects malloc() and free() to
+ft_ms_malloc() and ft_ms_free(), which count the bytes currently allocated,
+their peak, and the allocations made in each phase (set via ft_ms_phase()).
+
+The wrappers need no header in front of each block: the size of a block is
+its usable size, as reported by malloc_usable_size(). So ft_ms_free() also
+accepts blocks allocated elsewhere (e.g. by readline()), which should be
+counted via ft_ms_adopt() to keep the numbers balanced.
+
+Without MEMSTAT, nothing calls the wrappers and ft_ms_adopt() does nothing.
+*/
+
+#include <malloc.h>
+#include "libft.h"
+
+#undef malloc
+#undef free
+
+/*
+Returns the counters of this process.
+*/
+t_memstat	*ft_memstat(void)
+{
+	static t_memstat	memstat;
+
+	return (&memstat);
+}
+
+/*
+Counts a block as allocated in the current phase.
+*/
+void	ft_ms_adopt(void *ptr)
+{
+	t_memstat	*ms;
+	size_t		size;
+
+	if (!FT_MEMSTAT || !ptr)
+		return ;
+	ms = ft_memstat();
+	size = malloc_usable_size(ptr);
+	ms->live += size;
+	if (ms->live > ms->peak)
+		ms->peak = ms->live;
+	ms->allocs++;
+	ms->phase_allocs[ms->phase]++;
+	ms->phase_bytes[ms->phase] += size;
+}
+
+/*
+Allocates size bytes with malloc() and counts the block.
+*/
+void	*ft_ms_malloc(size_t size)
+{
+	void	*ptr;
+
+	ptr = malloc(size);
+	ft_ms_adopt(ptr);
+	return (ptr);
+}
+
+/*
+Frees a block with free() and removes it from the allocated bytes.
+*/
+void	ft_ms_free(void *ptr)
+{
+	t_memstat	*ms;
+
+	if (!ptr)
+		return ;
+	ms = ft_memstat();
+	ms->live -= malloc_usable_size(ptr);
+	ms->frees++;
+	free(ptr);
+}
+
+/*
+Sets the phase new allocations are counted in (0 to FT_MS_PHASES - 1, other
+values are ignored). Returns the previous phase, so it can be restored.
+*/
+int	ft_ms_phase(int phase)
+{
+	t_memstat	*ms;
+	int			previous;
+
+	ms = ft_memstat();
+	previous = ms->phase;
+	if (phase >= 0 && phase < FT_MS_PHASES)
+		ms->phase = phase;
+	return (previous);
+}
@@ -0,0 +1,161 @@
+/*
+Private header for the string/memory kernels (ft_strlen, ft_memchr, ft_strchr,
+ft_memcpy, ft_strcmp), which process a whole block of bytes per step instead
+of a single byte.
+
+A block is either a 16-byte SSE2 vector (always available on x86-64) or, as
+a portable fallback, a machine word, which is handled with SWAR ("SIMD within
+a register") bit tricks. Both variants provide the same small interface, so
+each kernel is only written once:
+
+- ft_load():		Loads a block from an address aligned to FT_BLOCK.
+					An aligned load never crosses a page boundary, so it is
+					safe to read bytes past the end of a string within it.
+- ft_loadu():		Loads a block from any address.
+- ft_storeu():		Stores a block to any address.
+- ft_splat():		Returns a block with all bytes set to c.
+- ft_zero_mask():	Returns a mask of the bytes in the block that are zero.
+- ft_eq_mask():		Returns a mask of the bytes that are equal in both blocks.
+- ft_first():		Returns the index of the first byte set in a mask.
+
+A mask holds FT_MASK_STEP bits per byte (1 for SSE2, 8 for SWAR, where only
+the highest bit of each byte is used), with byte 0 in the lowest bits.
+The SWAR variant therefore requires a little-endian machine; on other
+machines the kernels fall back to plain byte loops (FT_NO_BLOCKS).
+FT_FULL_MASK is the mask with all bytes of a block set.
+
+These are static inline functions, which are always inlined (even without
+optimizations, as libft is built by default), so each of them costs only a
+few instructions in the kernels' loops. The header must only be included by
+the kernels themselves.
+*/
+
+#ifndef FT_SIMD_H
+# define FT_SIMD_H
+
+# include <stddef.h> // size_t
+# include <stdint.h> // uintptr_t
+
+# define FT_INLINE	static inline __attribute__((always_inline))
+
+# if defined(__SSE2__)
+
+#  include <emmintrin.h> // SSE2 intrinsics
+
+typedef __m128i		t_block;
+typedef unsigned	t_mask;
+
+#  define FT_BLOCK		16
+#  define FT_MASK_STEP	1
+#  define FT_FULL_MASK	0xFFFFu
+
+FT_INLINE t_block	ft_load(const void *p)
+{
+	return (_mm_load_si128((const __m128i *)p));
+}
+
+FT_INLINE t_block	ft_loadu(const void *p)
+{
+	return (_mm_loadu_si128((const __m128i *)p));
+}
+
+FT_INLINE void	ft_storeu(void *p, t_block b)
+{
+	_mm_storeu_si128((__m128i *)p, b);
+}
+
+FT_INLINE t_block	ft_splat(unsigned char c)
+{
+	return (_mm_set1_epi8((char)c));
+}
+
+FT_INLINE t_mask	ft_eq_mask(t_block a, t_block b)
+{
+	return ((t_mask)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+}
+
+FT_INLINE t_mask	ft_zero_mask(t_block a)
+{
+	return (ft_eq_mask(a, _mm_setzero_si128()));
+}
+
+# elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+// 'may_alias' allows to access any byte buffer as words.
+typedef size_t		t_block __attribute__((may_alias));
+typedef size_t		t_mask;
+
+#  define FT_BLOCK		8
+#  define FT_MASK_STEP	8
+#  define FT_FULL_MASK	(~FT_LOWS)
+
+// 0x0101...01 and 0x7F7F...7F, for any word size
+#  define FT_ONES	((size_t)-1 / 0xFF)
+#  define FT_LOWS	((size_t)-1 / 0xFF * 0x7F)
+
+FT_INLINE t_block	ft_load(const void *p)
+{
+	return (*(const t_block *)p);
+}
+
+FT_INLINE t_block	ft_loadu(const void *p)
+{
+	t_block	b;
+
+	__builtin_memcpy(&b, p, sizeof(b));
+	return (b);
+}
+
+FT_INLINE void	ft_storeu(void *p, t_block b)
+{
+	__builtin_memcpy(p, &b, sizeof(b));
+}
+
+FT_INLINE t_block	ft_splat(unsigned char c)
+{
+	return (FT_ONES * c);
+}
+
+/*
+Sets the highest bit of every byte that is zero. Unlike the shorter
+'(a - ONES) & ~a & HIGHS', this is exact (no borrow from one byte into the
+next), so masks can be shifted to ignore bytes before the start of a string.
+*/
+FT_INLINE t_mask	ft_zero_mask(t_block a)
+{
+	return (~(((a & FT_LOWS) + FT_LOWS) | a | FT_LOWS));
+}
+
+FT_INLINE t_mask	ft_eq_mask(t_block a, t_block b)
+{
+	return (ft_zero_mask(a ^ b));
+}
+
+# else
+
+#  define FT_NO_BLOCKS
+
+# endif
+
+# ifndef FT_NO_BLOCKS
+
+/*
+Returns the index of the first byte set in a (non-zero) mask.
+*/
+FT_INLINE size_t	ft_first(t_mask mask)
+{
+	return ((size_t)__builtin_ctzll(mask) / FT_MASK_STEP);
+}
+
+/*
+Clears the bits of the first n bytes in a mask, e.g. the bytes in front of
+the start of a string in its first aligned block.
+*/
+FT_INLINE t_mask	ft_skip(t_mask mask, size_t n)
+{
+	return (mask >> (n * FT_MASK_STEP) << (n * FT_MASK_STEP));
+}
+
+# endif
+
+#endif
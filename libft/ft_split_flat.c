@@ -0,0 +1,66 @@
+#include "libft.h"
+
+/*
+Counts the words of s (separated by c) and the bytes of all words together.
+*/
+static size_t	count_words(const char *s, char c, size_t *chars)
+{
+	const char	*word;
+	size_t		len;
+	size_t		count;
+
+	count = 0;
+	*chars = 0;
+	while (ft_split_next(&s, c, &word, &len))
+	{
+		count++;
+		*chars += len;
+	}
+	return (count);
+}
+
+/*
+Copies the words of s into the string data area, which starts right after the
+NULL-terminated pointer table, and points the table at them.
+*/
+static void	fill_words(char **arr, const char *s, char c, char *data)
+{
+	const char	*word;
+	size_t		len;
+
+	while (ft_split_next(&s, c, &word, &len))
+	{
+		*arr++ = data;
+		ft_memcpy(data, word, len);
+		data[len] = '\0';
+		data += len + 1;
+	}
+	*arr = NULL;
+}
+
+/*
+ft_split_flat() splits s into words just like ft_split(), but returns all of
+them in a single allocation: The NULL-terminated pointer table is followed by
+the words themselves, packed one after the other:
+
+	[ptr 0][ptr 1]...[NULL]["word0\0"]["word1\0"]...
+
+It is used like the array returned by ft_split(), but freed with a single
+call to free() (NOT ft_freearray()), and only takes one malloc() instead of
+one per word.
+*/
+char	**ft_split_flat(const char *s, char c)
+{
+	size_t	count;
+	size_t	chars;
+	char	**arr;
+
+	if (!s)
+		return (NULL);
+	count = count_words(s, c, &chars);
+	arr = malloc(sizeof(char *) * (count + 1) + chars + count);
+	if (!arr)
+		return (NULL);
+	fill_words(arr, s, c, (char *)(arr + count + 1));
+	return (arr);
+}
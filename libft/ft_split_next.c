@@ -0,0 +1,38 @@
+#include "libft.h"
+
+/*
+ft_split_next() is a non-allocating alternative to ft_split(): Instead of
+copying all words into an array, it finds one word after the other, directly
+in the string.
+
+The cursor *s points to where the search for the next word starts; it is
+advanced past the word found, so the function can be called in a loop.
+Words are separated by one or more instances of the character c, just like
+in ft_split(). The word is not NUL-terminated (it is part of the string),
+so its position and length are returned via 'word' and 'len'.
+
+Returns 1 if a word was found, 0 if the end of the string was reached.
+
+	const char	*cursor = "usr:bin";
+	const char	*word;
+	size_t		len;
+
+	while (ft_split_next(&cursor, ':', &word, &len))
+		write(1, word, len);
+*/
+int	ft_split_next(const char **s, char c, const char **word, size_t *len)
+{
+	const char	*end;
+
+	while (**s && **s == c)
+		(*s)++;
+	if (!**s)
+		return (0);
+	end = ft_strchr(*s, c);
+	if (!end)
+		end = *s + ft_strlen(*s);
+	*word = *s;
+	*len = end - *s;
+	*s = end;
+	return (1);
+}
@@ -0,0 +1,95 @@
+/*
+t_strbuf is a growable string: Instead of creating a new string for every
+ft_strjoin(), text is appended to one buffer, which grows geometrically
+(doubling its capacity), so building a string of n bytes only takes
+O(log n) allocations and copies every byte about once.
+
+The buffer is always NUL-terminated (once it is allocated), so sb->buf can be
+used as a regular string at any time. All functions that may allocate return
+1 on success and 0 on malloc failure, in which case the buffer is left as it
+was.
+
+	t_strbuf	sb;
+
+	ft_sb_init(&sb);
+	ft_sb_adds(&sb, "NAME");
+	ft_sb_addc(&sb, '=');
+	str = ft_sb_steal(&sb);		// or: ft_sb_free(&sb);
+*/
+
+#include "libft.h"
+
+/*
+Initializes an empty buffer. Nothing is allocated until the first append.
+*/
+void	ft_sb_init(t_strbuf *sb)
+{
+	sb->buf = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+}
+
+/*
+Makes sure there is room for 'extra' more bytes (plus the terminating NUL),
+growing the capacity to at least double its current size.
+*/
+int	ft_sb_reserve(t_strbuf *sb, size_t extra)
+{
+	size_t	cap;
+	char	*buf;
+
+	if (sb->len + extra < sb->cap)
+		return (1);
+	cap = FT_SB_MIN_CAP;
+	if (sb->cap * 2 > cap)
+		cap = sb->cap * 2;
+	if (sb->len + extra + 1 > cap)
+		cap = sb->len + extra + 1;
+	buf = malloc(cap);
+	if (!buf)
+		return (0);
+	if (sb->buf)
+		ft_memcpy(buf, sb->buf, sb->len + 1);
+	else
+		buf[0] = '\0';
+	free(sb->buf);
+	sb->buf = buf;
+	sb->cap = cap;
+	return (1);
+}
+
+/*
+Empties the buffer, but keeps its memory, so it can be reused for the next
+string without allocating again.
+*/
+void	ft_sb_reset(t_strbuf *sb)
+{
+	sb->len = 0;
+	if (sb->buf)
+		sb->buf[0] = '\0';
+}
+
+/*
+Returns the buffer as a regular malloc'ed string (which the caller has to
+free) and leaves sb empty. Returns an empty string if nothing was appended,
+or NULL on malloc failure.
+*/
+char	*ft_sb_steal(t_strbuf *sb)
+{
+	char	*str;
+
+	if (!ft_sb_reserve(sb, 0))
+		return (NULL);
+	str = sb->buf;
+	ft_sb_init(sb);
+	return (str);
+}
+
+/*
+Frees the buffer's memory and leaves sb empty.
+*/
+void	ft_sb_free(t_strbuf *sb)
+{
+	free(sb->buf);
+	ft_sb_init(sb);
+}
@@ -0,0 +1,72 @@
+#include "libft.h"
+
+/*
+Appends the character c to the buffer.
+*/
+int	ft_sb_addc(t_strbuf *sb, char c)
+{
+	if (!ft_sb_reserve(sb, 1))
+		return (0);
+	sb->buf[sb->len++] = c;
+	sb->buf[sb->len] = '\0';
+	return (1);
+}
+
+/*
+Appends the first n bytes of s to the buffer (s does not have to be
+NUL-terminated).
+*/
+int	ft_sb_addn(t_strbuf *sb, const char *s, size_t n)
+{
+	if (!ft_sb_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->buf + sb->len, s, n);
+	sb->len += n;
+	sb->buf[sb->len] = '\0';
+	return (1);
+}
+
+/*
+Appends the string s to the buffer.
+*/
+int	ft_sb_adds(t_strbuf *sb, const char *s)
+{
+	return (ft_sb_addn(sb, s, ft_strlen(s)));
+}
+
+/*
+Appends the decimal representation of the unsigned number n to the buffer,
+without creating a temporary string like ft_itoa(). The digits are written
+from right to left into a small local array, which is large enough for any
+size_t.
+*/
+int	ft_sb_addunbr(t_strbuf *sb, size_t n)
+{
+	char	digits[20];
+	size_t	i;
+
+	i = sizeof(digits);
+	digits[--i] = '0' + n % 10;
+	n /= 10;
+	while (n > 0)
+	{
+		digits[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	return (ft_sb_addn(sb, digits + i, sizeof(digits) - i));
+}
+
+/*
+Appends the decimal representation of n to the buffer. For a negative n, room
+for the sign and all digits is reserved first, so the buffer is still left as
+it was if malloc fails.
+*/
+int	ft_sb_addnbr(t_strbuf *sb, long n)
+{
+	if (n >= 0)
+		return (ft_sb_addunbr(sb, n));
+	if (!ft_sb_reserve(sb, 21))
+		return (0);
+	sb->buf[sb->len++] = '-';
+	return (ft_sb_addunbr(sb, -(unsigned long)n));
+}
@@ -1,4 +1,5 @@
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 The strchr() function is designed to locate a specific character within a string.
@@ -7,7 +8,44 @@ of that particular character. In the event that no instance of the character is
 found, the function returns NULL.
 It's important to note that if the character being searched for is '\0',
 the function still needs to return a pointer pointing to this character.
+
+The string is scanned block by block (see ft_simd.h) for the first byte that
+is either the character or the NUL terminator, whichever comes first.
 */
+#ifndef FT_NO_BLOCKS
+
+static t_mask	stop_mask(const char *p, t_block needle)
+{
+	t_block	block;
+
+	block = ft_load(p);
+	return (ft_eq_mask(block, needle) | ft_zero_mask(block));
+}
+
+char	*ft_strchr(const char *s, int c)
+{
+	const char	*p;
+	t_block		needle;
+	t_mask		mask;
+	size_t		offset;
+
+	offset = (uintptr_t)s % FT_BLOCK;
+	p = s - offset;
+	needle = ft_splat((unsigned char)c);
+	mask = ft_skip(stop_mask(p, needle), offset);
+	while (!mask)
+	{
+		p += FT_BLOCK;
+		mask = stop_mask(p, needle);
+	}
+	p += ft_first(mask);
+	if (*p == (char)c)
+		return ((char *)p);
+	return (NULL);
+}
+
+#else
+
 char	*ft_strchr(const char *s, int c)
 {
 	char	char_c;
@@ -24,6 +62,8 @@ char	*ft_strchr(const char *s, int c)
 	return (NULL);
 }
 
+#endif
+
 /*
 #include <stdio.h>
 #include <string.h>
@@ -1,4 +1,5 @@
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 Like the strncmp() function, but compares entire strings, no need to pass
@@ -11,6 +12,61 @@ a size.
 -	If the first differing character in s2 is less than the character at the
 	same position in s1, the result is positive.
 */
+#ifndef FT_NO_BLOCKS
+
+/*
+Used in ft_strcmp().
+
+Checks if an unaligned block load at p could cross into the next page, which
+might not be mapped (the string itself could end right before it).
+*/
+static int	crosses_page(const char *p)
+{
+	return ((uintptr_t)p % 4096 > 4096 - FT_BLOCK);
+}
+
+/*
+Used in ft_strcmp().
+
+Compares the strings a block (see ft_simd.h) at a time. Sets 'mask' to the
+bytes that differ or are the NUL terminator of s1. Near a page boundary, only
+a single byte is compared.
+Returns the number of bytes compared.
+*/
+static size_t	compare_block(const char *s1, const char *s2, t_mask *mask)
+{
+	t_block	block;
+
+	if (crosses_page(s1) || crosses_page(s2))
+	{
+		*mask = (*s1 != *s2 || !*s1);
+		return (1);
+	}
+	block = ft_loadu(s1);
+	*mask = (~ft_eq_mask(block, ft_loadu(s2)) & FT_FULL_MASK)
+		| ft_zero_mask(block);
+	return (FT_BLOCK);
+}
+
+int	ft_strcmp(const char *s1, const char *s2)
+{
+	t_mask	mask;
+	size_t	step;
+	size_t	i;
+
+	i = 0;
+	step = compare_block(s1, s2, &mask);
+	while (!mask)
+	{
+		i += step;
+		step = compare_block(s1 + i, s2 + i, &mask);
+	}
+	i += ft_first(mask);
+	return ((unsigned char)s1[i] - (unsigned char)s2[i]);
+}
+
+#else
+
 int	ft_strcmp(const char *s1, const char *s2)
 {
 	size_t	i;
@@ -20,3 +76,5 @@ int	ft_strcmp(const char *s1, const char *s2)
 		i++;
 	return ((unsigned char)s1[i] - (unsigned char)s2[i]);
 }
+
+#endif
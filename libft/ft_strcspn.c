@@ -0,0 +1,88 @@
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+The strcspn() function calculates the length of the initial segment of s
+which consists entirely of bytes not in reject, i.e. the index of the first
+byte of s that is in reject (or of the NUL terminator, if there is none).
+
+The string is scanned block by block (see ft_simd.h): Each block is compared
+against every byte of reject at once, so the cost per block only depends on
+the size of reject. Sets larger than FT_CSPN_MAX bytes are checked byte by
+byte.
+*/
+
+#define FT_CSPN_MAX	16
+
+/*
+Used in ft_strcspn().
+
+Checks byte by byte, used for large sets of bytes (and if blocks are not
+supported). ft_strchr() also finds the NUL terminator, so the loop stops at
+the end of s as well.
+*/
+static size_t	strcspn_bytes(const char *s, const char *reject)
+{
+	size_t	i;
+
+	i = 0;
+	while (!ft_strchr(reject, s[i]))
+		i++;
+	return (i);
+}
+
+#ifndef FT_NO_BLOCKS
+
+/*
+Used in ft_strcspn().
+
+Returns the mask of all bytes in the aligned block at p that are either in
+the set (given as blocks of repeated bytes in needles) or zero.
+*/
+static t_mask	stop_mask(const char *p, const t_block *needles, size_t count)
+{
+	t_block	block;
+	t_mask	mask;
+
+	block = ft_load(p);
+	mask = ft_zero_mask(block);
+	while (count--)
+		mask |= ft_eq_mask(block, needles[count]);
+	return (mask);
+}
+
+size_t	ft_strcspn(const char *s, const char *reject)
+{
+	t_block		needles[FT_CSPN_MAX];
+	const char	*p;
+	size_t		count;
+	size_t		offset;
+	t_mask		mask;
+
+	count = 0;
+	while (reject[count] && count < FT_CSPN_MAX)
+	{
+		needles[count] = ft_splat((unsigned char)reject[count]);
+		count++;
+	}
+	if (reject[count])
+		return (strcspn_bytes(s, reject));
+	offset = (uintptr_t)s % FT_BLOCK;
+	p = s - offset;
+	mask = ft_skip(stop_mask(p, needles, count), offset);
+	while (!mask)
+	{
+		p += FT_BLOCK;
+		mask = stop_mask(p, needles, count);
+	}
+	return (p - s + ft_first(mask));
+}
+
+#else
+
+size_t	ft_strcspn(const char *s, const char *reject)
+{
+	return (strcspn_bytes(s, reject));
+}
+
+#endif
@@ -11,16 +11,13 @@ insufficient available memory, it returns NULL.
 char	*ft_strdup(const char *src)
 {
 	char	*new_s;
-	int		i;
+	size_t	len;
 
-	i = 0;
-	new_s = (char *)malloc(sizeof(char) * (ft_strlen(src) + 1));
+	len = ft_strlen(src) + 1;
+	new_s = (char *)malloc(sizeof(char) * len);
 	if (!new_s)
 		return (NULL);
-	while (*src)
-		new_s[i++] = *src++;
-	new_s[i] = '\0';
-	return (new_s);
+	return (ft_memcpy(new_s, src, len));
 }
 
 /*
@@ -0,0 +1,48 @@
+#include "libft.h"
+
+/*
+Sums up the lengths of the next n strings in args.
+Returns SIZE_MAX if one of them is NULL.
+*/
+static size_t	sum_lengths(int n, va_list args)
+{
+	size_t		total;
+	const char	*s;
+
+	total = 0;
+	while (n-- > 0)
+	{
+		s = va_arg(args, const char *);
+		if (!s)
+			return (SIZE_MAX);
+		total += ft_strlen(s);
+	}
+	return (total);
+}
+
+/*
+Joins n strings (passed as variadic arguments) into a single new string, e.g.
+ft_strjoin_n(3, "NAME", "=", "value"). Unlike a chain of ft_strjoin() calls,
+this creates no intermediate strings: The lengths are summed up in a first
+pass, then all strings are copied into one allocation.
+
+Returns NULL if any of the strings is NULL or on malloc failure.
+*/
+char	*ft_strjoin_n(int n, ...)
+{
+	va_list		args;
+	t_strbuf	sb;
+	size_t		total;
+
+	va_start(args, n);
+	total = sum_lengths(n, args);
+	va_end(args);
+	ft_sb_init(&sb);
+	if (total == SIZE_MAX || !ft_sb_reserve(&sb, total))
+		return (NULL);
+	va_start(args, n);
+	while (n-- > 0)
+		ft_sb_adds(&sb, va_arg(args, const char *));
+	va_end(args);
+	return (ft_sb_steal(&sb));
+}
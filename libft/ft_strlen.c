@@ -1,10 +1,38 @@
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 Computes the length of the null-terminated string str.
 The function returns the number of characters in the string str, excluding
 the NUL terminator ('\0').
+
+Instead of checking byte by byte, the string is scanned one aligned block
+(see ft_simd.h) at a time for the NUL terminator. The first block starts
+before str, the bytes in front of str are skipped in its mask.
 */
+#ifndef FT_NO_BLOCKS
+
+size_t	ft_strlen(const char *str)
+{
+	const char	*p;
+	t_mask		mask;
+	size_t		offset;
+
+	if (!str)
+		return (-1);
+	offset = (uintptr_t)str % FT_BLOCK;
+	p = str - offset;
+	mask = ft_skip(ft_zero_mask(ft_load(p)), offset);
+	while (!mask)
+	{
+		p += FT_BLOCK;
+		mask = ft_zero_mask(ft_load(p));
+	}
+	return (p - str + ft_first(mask));
+}
+
+#else
+
 size_t	ft_strlen(const char *str)
 {
 	size_t	i;
@@ -17,6 +45,8 @@ size_t	ft_strlen(const char *str)
 	return (i);
 }
 
+#endif
+
 /*
 #include <stdio.h>
 int	main(void)
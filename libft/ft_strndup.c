@@ -0,0 +1,25 @@
+#include "libft.h"
+
+/*
+The strndup() function works like strdup(), but copies at most n bytes of
+'src' into the newly allocated string, which is always NUL-terminated.
+
+Only the first n bytes of 'src' are looked at, so a short substring can be
+copied out of a long string without scanning all of it (unlike ft_substr(),
+which has to check that 'start' is within the string first).
+*/
+char	*ft_strndup(const char *src, size_t n)
+{
+	char	*new_s;
+	char	*end;
+
+	end = ft_memchr(src, '\0', n);
+	if (end)
+		n = end - src;
+	new_s = (char *)malloc(sizeof(char) * (n + 1));
+	if (!new_s)
+		return (NULL);
+	ft_memcpy(new_s, src, n);
+	new_s[n] = '\0';
+	return (new_s);
+}
@@ -7,28 +7,19 @@ The ft_substr function takes a string s, a starting index start, and a length
 len as parameters. It first checks if the input string is NULL, and if so, it
 returns NULL to indicate an invalid input. It then verifies if the starting
 index is beyond the length of the string; if true, it returns an empty string.
-The function calculates the remaining length of the string after the specified
-start index and adjusts the length parameter if it exceeds the remaining length.
-Finally, the function allocates memory for a substring, copies the appropriate
-portion from the input string, and returns the newly allocated substring.
+Finally, the function copies at most len bytes starting at the start index into
+a newly allocated substring (see ft_strndup()) and returns it.
+
+Only the first start + len bytes of s are looked at, so taking a short
+substring of a long string does not scan all of it.
 */
 char	*ft_substr(const char *s, unsigned int start, size_t len)
 {
-	char	*substr;
-	size_t	remaining_len;
-
 	if (!s)
 		return (NULL);
-	if (start >= ft_strlen(s))
+	if (ft_memchr(s, '\0', start))
 		return (ft_strdup(""));
-	remaining_len = ft_strlen(s + start);
-	if (len > remaining_len)
-		len = remaining_len;
-	substr = (char *)malloc(sizeof(char) * (len + 1));
-	if (!substr)
-		return (NULL);
-	ft_strlcpy(substr, s + start, len +1);
-	return (substr);
+	return (ft_strndup(s + start, len));
 }
 
 /*
@@ -6,6 +6,17 @@
 # include <stddef.h> // size_t
 # include <stdint.h> // SIZE_MAX
 # include <stdarg.h> // variadic fcts
+# include <errno.h> // errno, EINTR
+
+// Maximum number of phases allocations are counted in (see t_memstat)
+# define FT_MS_PHASES	16
+
+// 1 if allocations are counted ('make MEMSTAT=1'), see ft_memstat.c
+# ifdef MEMSTAT
+#  define FT_MEMSTAT	1
+# else
+#  define FT_MEMSTAT	0
+# endif
 
 /*
 Used in libft functions for list manipulation.
@@ -25,6 +36,75 @@ typedef struct s_list
 	struct s_list	*next;
 }	t_list;
 
+/*
+Used in the ft_sb_* functions (see ft_strbuf.c), a growable string.
+- char *buf:	The NUL-terminated string built so far (NULL until the first
+				append).
+- size_t len:	The length of the string in buf.
+- size_t cap:	The number of bytes allocated for buf.
+*/
+typedef struct s_strbuf
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+}	t_strbuf;
+
+// Initial capacity of a t_strbuf
+# define FT_SB_MIN_CAP	64
+
+/*
+Used in the ft_gnl_* functions (see ft_gnl_reader.c), a line reader with a
+caller-owned, refillable buffer.
+- int fd:			The fd being read.
+- char *buf:		The buffer (cap + 1 bytes, for terminating the last line).
+- size_t cap:		The size of the buffer, grows if a line doesn't fit.
+- size_t start:		The start of the data not returned as a line yet.
+- size_t scan:		Where to continue searching for the next '\n'.
+- size_t end:		The end of the data read into the buffer.
+- size_t chunk:		The maximum number of bytes to read at once.
+- int eof:			1 once the end of the input was reached.
+*/
+typedef struct s_gnl_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	scan;
+	size_t	end;
+	size_t	chunk;
+	int		eof;
+}	t_gnl_reader;
+
+// Initial buffer size of a t_gnl_reader
+# define GNL_READER_SIZE	65536
+
+/*
+Used in the ft_ms_* functions (see ft_memstat.c), the allocation counters of
+a build with MEMSTAT defined. All sizes are the usable sizes of the blocks.
+- size_t live:			The bytes currently allocated.
+- size_t peak:			The highest value of live so far.
+- size_t allocs:		The number of allocations so far.
+- size_t frees:			The number of frees so far.
+- pid_t owner:			The process the counters are reported by (a child
+						process inherits a copy of them).
+- int phase:			The phase new allocations are counted in.
+- size_t phase_allocs:	The number of allocations per phase.
+- size_t phase_bytes:	The bytes allocated per phase.
+*/
+typedef struct s_memstat
+{
+	size_t	live;
+	size_t	peak;
+	size_t	allocs;
+	size_t	frees;
+	pid_t	owner;
+	int		phase;
+	size_t	phase_allocs[FT_MS_PHASES];
+	size_t	phase_bytes[FT_MS_PHASES];
+}	t_memstat;
+
 // Core Functions
 
 int		ft_isalpha(int c);
@@ -45,19 +125,24 @@ int		ft_toupper(int c);
 int		ft_tolower(int c);
 char	*ft_strchr(const char *s, int c);
 char	*ft_strrchr(const char *s, int c);
+size_t	ft_strcspn(const char *s, const char *reject);
 int		ft_strncmp(const char *s1, const char *s2, size_t n);
 char	*ft_strnstr(const char *big, const char *little, size_t len);
 int		ft_atoi(const char *nptr);
 void	*calloc(size_t nmemb, size_t size);
 void	*ft_calloc(size_t nmemb, size_t size);
 char	*ft_strdup(const char *s);
+char	*ft_strndup(const char *src, size_t n);
 
 // Secondary Functions
 
 char	*ft_substr(const char *s, unsigned int start, size_t len);
 char	*ft_strjoin(const char *s1, const char *s2);
+char	*ft_strjoin_n(int n, ...);
 char	*ft_strtrim(const char *s1, const char *set);
 char	**ft_split(const char *s, char c);
+char	**ft_split_flat(const char *s, char c);
+int		ft_split_next(const char **s, char c, const char **word, size_t *len);
 char	*ft_itoa(int n);
 char	*ft_strmapi(const char *s, char (*f)(unsigned int, char));
 void	ft_striteri(char *s, void (*f)(unsigned int, char*));
@@ -79,6 +164,27 @@ void	ft_lstiter(t_list *lst, void (*f)(void *));
 t_list	*ft_lstmap(t_list *lst, void *(*f)(void *),
 			void (*del)(void *));
 
+// String Builder
+
+void	ft_sb_init(t_strbuf *sb);
+int		ft_sb_reserve(t_strbuf *sb, size_t extra);
+void	ft_sb_reset(t_strbuf *sb);
+char	*ft_sb_steal(t_strbuf *sb);
+void	ft_sb_free(t_strbuf *sb);
+int		ft_sb_addc(t_strbuf *sb, char c);
+int		ft_sb_addn(t_strbuf *sb, const char *s, size_t n);
+int		ft_sb_adds(t_strbuf *sb, const char *s);
+int		ft_sb_addunbr(t_strbuf *sb, size_t n);
+int		ft_sb_addnbr(t_strbuf *sb, long n);
+
+// Allocation Accounting
+
+t_memstat	*ft_memstat(void);
+void		*ft_ms_malloc(size_t size);
+void		ft_ms_free(void *ptr);
+void		ft_ms_adopt(void *ptr);
+int			ft_ms_phase(int phase);
+
 //// Functions From Other Projects
 // Just useful in general
 
@@ -89,6 +195,10 @@ int		ft_atoi_base(const char *str, int str_base);
 
 int		ft_isbinary(char *stash);
 char	*get_next_line(int fd);
+int		ft_gnl_open(t_gnl_reader *r, int fd, size_t chunk);
+int		ft_gnl_next(t_gnl_reader *r, const char **line, size_t *len);
+int		ft_gnl_sync(t_gnl_reader *r);
+void	ft_gnl_close(t_gnl_reader *r);
 
 // Project: ft_printf
 
@@ -102,4 +212,11 @@ int		print_count_unsigned(unsigned int nbr);
 int		print_count_number(int nbr);
 int		print_count_hex(uintptr_t nbr, char format);
 
+// With MEMSTAT, every malloc() and free() of libft and of the files including
+// this header goes through the counting wrappers.
+# ifdef MEMSTAT
+#  define malloc	ft_ms_malloc
+#  define free		ft_ms_free
+# endif
+
 #endif
@@ -24,42 +24,71 @@ void	ft_env_tmp_add_back(t_env **head, t_env *new)
 	}
 }
 
-// Initializing a node of the envp_temp list.
-static t_env	*init_node_of_env(char *envp, t_env *node)
+// Counts the variables in the "envp"-array and returns the size of the slab
+// they are imported into: two nodes per variable (one for the envp_temp list,
+// one for the export list) and one copy of every string.
+static size_t	get_slab_size(char **envp, size_t *count)
 {
-	node->e_var = ft_substr(envp, 0, ft_strrchr_index(envp, '='));
-	if (!node->e_var)
-		mem_alloc_fail_env(&node);
-	node->value = ft_substr(envp, ft_strrchr_index(envp, '=') + 1, \
-	ft_strlen(envp));
-	if (!node->value)
-		mem_alloc_fail_env(&node);
+	size_t	strings;
+
+	*count = 0;
+	strings = 0;
+	while (envp[*count])
+		strings += ft_strlen(envp[(*count)++]) + 1;
+	return (sizeof(t_env) * 2 * *count + strings);
+}
+
+// Initializing a node of the envp_temp list: The variable is copied to 'str'
+// in the slab and split at its first '=' (the value may contain more of
+// them). Returns the position in the slab after the copy.
+static char	*init_node_of_env(char *envp, t_env *node, char *str)
+{
+	size_t	len;
+	char	*equal_sign;
+
+	len = ft_strlen(envp);
+	ft_memcpy(str, envp, len + 1);
+	node->e_var = str;
+	node->value = str + len;
+	equal_sign = ft_strchr(str, '=');
+	if (equal_sign)
+	{
+		*equal_sign = '\0';
+		node->value = equal_sign + 1;
+	}
 	node->next = NULL;
 	node->previous = NULL;
-	node->printed = 0;
-	return (node);
+	return (str + len + 1);
 }
 
 // Initializing the envp_temp list. Essentially copies the "envp"-array
-// into a new linked list.
+// into a new linked list, in a single pass and with a single allocation
+// (see get_env_slab()), so startup stays fast even with a huge environment.
 t_env	*init_env_tmp(char **envp)
 {
-	t_env	*head;
-	t_env	*node;
-	int		i;
+	t_env_slab	*slab;
+	t_env		*nodes;
+	char		*str;
+	size_t		i;
 
-	i = 1;
-	head = malloc(sizeof(t_env));
-	if (!head)
-		mem_alloc_fail_env(&head);
-	head = init_node_of_env(envp[0], head);
-	while (envp[i])
+	slab = get_env_slab();
+	slab->size = get_slab_size(envp, &slab->count);
+	if (slab->count == 0)
+		return (NULL);
+	slab->start = malloc(slab->size);
+	if (!slab->start)
+		mem_alloc_fail_env(NULL);
+	nodes = (t_env *)slab->start;
+	str = slab->start + sizeof(t_env) * 2 * slab->count;
+	i = 0;
+	while (i < slab->count)
 	{
-		node = malloc(sizeof(t_env));
-		if (!node)
-			mem_alloc_fail_env(&head);
-		node = init_node_of_env(envp[i++], node);
-		ft_env_tmp_add_back(&head, node);
+		str = init_node_of_env(envp[i], &nodes[i], str);
+		nodes[i].next = &nodes[i + 1];
+		if (i > 0)
+			nodes[i].previous = &nodes[i - 1];
+		i++;
 	}
-	return (head);
+	nodes[i - 1].next = NULL;
+	return (nodes);
 }
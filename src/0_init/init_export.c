@@ -4,93 +4,86 @@
 
 t_env	*init_export_list(t_data *data);
 
-// Checks the length of the envp_temp list (how many nodes).
-static int	list_length(t_env *envp_temp)
+// Merges two lists, which are sorted alphabetically, into one (only linked
+// via 'next').
+static t_env	*merge_sorted(t_env *left, t_env *right)
 {
-	int	len;
+	t_env	head;
+	t_env	*tail;
 
-	len = 0;
-	while (envp_temp)
+	tail = &head;
+	while (left && right)
 	{
-		envp_temp = envp_temp->next;
-		len++;
+		if (ft_strcmp(left->e_var, right->e_var) <= 0)
+		{
+			tail->next = left;
+			left = left->next;
+		}
+		else
+		{
+			tail->next = right;
+			right = right->next;
+		}
+		tail = tail->next;
 	}
-	return (len);
-}
-
-// Initializes the head of the export_list, if the lowest node is the first
-// element of the list.
-static t_env	*init_head_export_list(t_data *data, t_env *lowest_node)
-{
-	data->export_list = malloc(sizeof(t_env));
-	if (!data->export_list)
-		export_mem_alloc_failure(data);
-	data->export_list->next = NULL;
-	data->export_list->previous = NULL;
-	data->export_list->printed = 0;
-	data->export_list->e_var = ft_strdup(lowest_node->e_var);
-	data->export_list->value = ft_strdup(lowest_node->value);
-	if (!data->export_list->e_var || !data->export_list->value)
-		export_mem_alloc_failure(data);
-	lowest_node->printed = 1;
-	return (data->export_list);
+	tail->next = left;
+	if (!left)
+		tail->next = right;
+	return (head.next);
 }
 
-// Adds the current lowest alphabetical value environmental variable
-// from envp_temp to export_list.
-// If export_list doesn't exist, meaning it is the lowest_node is the first
-// node to be added, the functin initializes export_list.
-// @param lowest_node The current node that should be added to export_list.
-static t_env	*build_export_list(t_data *data, t_env *lowest_node)
+// Sorts the first 'len' nodes of a list alphabetically with a merge sort,
+// which takes O(n log n) comparisons.
+static t_env	*sort_env_list(t_env *list, size_t len)
 {
-	t_env	*node;
+	t_env	*last;
+	t_env	*right;
+	size_t	i;
 
-	if (!data->export_list)
-		return (init_head_export_list(data, lowest_node));
-	node = malloc(sizeof(t_env));
-	if (!node)
-		export_mem_alloc_failure(data);
-	node->next = NULL;
-	node->previous = NULL;
-	node->printed = 0;
-	node->e_var = ft_strdup(lowest_node->e_var);
-	node->value = ft_strdup(lowest_node->value);
-	if (!node->e_var || !node->value)
-		export_mem_alloc_failure(data);
-	ft_env_tmp_add_back(&data->export_list, node);
-	lowest_node->printed = 1;
-	return (data->export_list);
+	if (len < 2)
+	{
+		list->next = NULL;
+		return (list);
+	}
+	last = list;
+	i = 1;
+	while (i++ < len / 2)
+		last = last->next;
+	right = last->next;
+	last->next = NULL;
+	return (merge_sorted(sort_env_list(list, len / 2),
+			sort_env_list(right, len - len / 2)));
 }
 
-// Initializes the export_list.
-// A sorting algorithm to sort the environmental variables alphabetically.
-// Iterates through the envp_temp-list, taking the element
-// with the lowest alphabetical value that has NOT been stored yet,
-// and adds it to the export_list. Goes through the envp_temp-list until all
-// elements have been added to export_list.
+// Initializes the export list, which holds the same variables as the
+// envp_temp list, but sorted alphabetically. Its nodes are the second half of
+// the slab (see init_env_tmp()), and share the strings of the envp_temp list
+// instead of copying them.
 t_env	*init_export_list(t_data *data)
 {
-	t_env	*current;
-	t_env	*lowest_node;
-	int		len;
-	int		count;
+	t_env_slab	*slab;
+	t_env		*nodes;
+	t_env		*current;
+	size_t		i;
 
-	len = list_length(data->envp_temp);
-	count = 0;
-	while (count < len)
+	slab = get_env_slab();
+	if (!data->envp_temp || slab->count == 0)
+		return (NULL);
+	nodes = (t_env *)slab->start + slab->count;
+	i = 0;
+	while (i < slab->count)
 	{
-		current = data->envp_temp;
-		lowest_node = NULL;
-		while (current)
-		{
-			if (!current->printed && (!lowest_node
-					|| ft_strcmp(current->e_var, lowest_node->e_var) < 0))
-				lowest_node = current;
-			current = current->next;
-		}
-		if (lowest_node)
-			data->export_list = build_export_list(data, lowest_node);
-		count++;
+		nodes[i] = data->envp_temp[i];
+		nodes[i].next = &nodes[i + 1];
+		i++;
+	}
+	data->export_list = sort_env_list(nodes, slab->count);
+	current = data->export_list;
+	current->previous = NULL;
+	while (current->next)
+	{
+		current->next->previous = current;
+		current = current->next;
 	}
 	return (data->export_list);
 }
@@ -79,23 +79,24 @@ t_list	*create_tok(t_data *data, t_token_type type, const char *lexeme, int *i)
 Used in get_tokens().
 
 Extracts a token from the input string starting at position *i until a
-delimiter is encountered.
+delimiter (outside of quotes) is encountered.
 
  @return	`0` if memory allocation fails during substring creation or token
  			node creation.
 			`1` if the token is successfully added OR if no token was added as
-			data->input[*i] is whitespace or is at the end of the input string.
+			data->input[*i] is whitespace, a ';' (e.g. the second one of ';;')
+			or is at the end of the input string.
 */
 static int	add_other_token(t_data *data, int *i)
 {
 	int	start;
 
 	start = *i;
-	if (data->input[*i] && !is_whitespace(data->input[*i]))
+	if (data->input[*i] && !is_whitespace(data->input[*i])
+		&& data->input[*i] != ';')
 	{
-		while (!is_delimiter(data, data->input[*i]))
-			(*i)++;
-		data->tok.tmp = ft_substr(data->input, start, (*i) - start);
+		*i = skip_word(data->input, *i);
+		data->tok.tmp = ft_strndup(data->input + start, (*i) - start);
 		if (!data->tok.tmp)
 			return (0);
 		data->tok.new_node = create_tok(data, OTHER, data->tok.tmp, &start);
@@ -105,18 +106,18 @@ static int	add_other_token(t_data *data, int *i)
 			free_unlinked_token(data);
 			return (0);
 		}
-		ft_lstadd_back(&data->tok.tok_lst, data->tok.new_node);
+		add_token(data);
 		free(data->tok.tmp);
 	}
 	return (1);
 }
 
 /**
-Updates the position of each token in the token list to reflect its position
-within the list.
+Used in get_tokens().
 
-This function traverses the token list and assigns the `position` member of each
-token to its index in the list.
+Updates the position of each token in the token list to reflect its position
+within the list (see number_tokens()). Prints an error message if the list is
+empty.
 
  @param data 	Pointer to the data structure containing the token list.
 
@@ -124,24 +125,12 @@ token to its index in the list.
 */
 static int	update_token_positions(t_data *data)
 {
-	t_list	*current;
-	t_token	*token;
-	int		position;
-
-	if (!data || !data->tok.tok_lst)
-		return (0);
-	current = data->tok.tok_lst;
-	token = NULL;
-	position = 0;
-	while (current)
+	if (!data->tok.tok_lst)
 	{
-		token = (t_token *)current->content;
-		if (!token)
-			return (0);
-		token->position = position;
-		position++;
-		current = current->next;
+		print_err_msg(ERR_TOKEN);
+		return (0);
 	}
+	number_tokens(data->tok.tok_lst);
 	return (1);
 }
 
@@ -153,6 +142,7 @@ specific criteria:
 - Skips leading whitespace characters.
 - Checks for redirection operators and adds tokens if found.
 - Adds a token for the pipe character `|` if found.
+- Adds a token for a command separator (`;` or a newline) if found.
 - Treats remaining parts of the input string as OTHER tokens.
 
 For each token, it creates a new token node and adds it to the token list.
@@ -169,24 +159,20 @@ int	get_tokens(t_data *data)
 	i = 0;
 	while (data->input[i])
 	{
-		while (is_whitespace(data->input[i]))
+		while (is_whitespace(data->input[i]) && data->input[i] != '\n')
 			i++;
 		data->tok.r_redir = is_redirection(data, &i);
 		data->tok.r_pipe = is_pipe(data, &i);
+		data->tok.r_sep = is_separator(data, &i);
 		data->tok.r_other = add_other_token(data, &i);
 		if (data->tok.r_redir <= 0 || data->tok.r_pipe <= 0
-			|| data->tok.r_other == 0)
+			|| data->tok.r_sep == 0 || data->tok.r_other == 0)
 		{
 			if (data->tok.r_redir == 0 || data->tok.r_pipe == 0
-				|| data->tok.r_other == 0)
+				|| data->tok.r_sep == 0 || data->tok.r_other == 0)
 				print_err_msg(ERR_TOKEN);
 			return (0);
 		}
 	}
-	if (!update_token_positions(data))
-	{
-		print_err_msg(ERR_TOKEN);
-		return (0);
-	}
-	return (1);
+	return (update_token_positions(data));
 }
@@ -0,0 +1,125 @@
+/**
+This file implements the parse cache: Scripts and interactive sessions often
+run the same command line again, so the tokens of the last PARSE_CACHE_SIZE
+distinct lines are kept. A repeated line is neither checked for unclosed
+quotes nor tokenized again; it gets a copy of the cached tokens, which then
+go through heredocs, variable expansion and quote removal as usual (those
+depend on the environment and the input at the time the line is run).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int		get_cached_tokens(t_data *data);
+void	free_parse_cache(t_parse_cache *cache);
+
+/**
+Used in get_cached_tokens().
+
+Tokenizes the current line and stores its tokens in the cache, replacing an
+unused or else the least recently used entry. Lines longer than
+PARSE_CACHE_MAX_LEN are not cached, neither are lines whose tokens could not
+be copied.
+*/
+static int	tokenize_and_store(t_data *data)
+{
+	t_cache_entry	*entry;
+
+	if (!get_tokens(data))
+		return (0);
+	if (ft_strlen(data->input) > PARSE_CACHE_MAX_LEN)
+		return (1);
+	entry = get_lru_entry(&data->cache);
+	free(entry->input);
+	ft_lstclear(&entry->tokens, del_token);
+	entry->len = ft_strlen(data->input);
+	entry->used = ++data->cache.clock;
+	entry->input = ft_strdup(data->input);
+	entry->tokens = copy_tokens(data->tok.tok_lst, NULL);
+	if (!entry->input || !entry->tokens)
+	{
+		free(entry->input);
+		entry->input = NULL;
+		ft_lstclear(&entry->tokens, del_token);
+	}
+	return (1);
+}
+
+/**
+Used in get_cached_tokens().
+
+Copies the tokens of the entry found in the cache into the token list.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	use_cached_tokens(t_data *data)
+{
+	t_cache_entry	*entry;
+
+	entry = &data->cache.entries[data->cache.hit];
+	entry->used = ++data->cache.clock;
+	data->tok.tok_lst = copy_tokens(entry->tokens, NULL);
+	if (!data->tok.tok_lst)
+	{
+		print_err_msg(ERR_TOKEN);
+		return (0);
+	}
+	data->tok.tok_last = ft_lstlast(data->tok.tok_lst);
+	return (1);
+}
+
+/**
+Used in handle_input().
+
+Provides the tokens of the current line: If the line is in the parse cache,
+its tokens are copied from there. Otherwise the line is checked for unclosed
+quotes and tokenized, and its tokens are added to the cache.
+
+ @param data 	Pointer to the data struct.
+
+ @return	`1` if the token list was created;
+			`0` if the line has unclosed quotes or tokenization failed.
+*/
+int	get_cached_tokens(t_data *data)
+{
+	t_parse_cache	*cache;
+	size_t			len;
+
+	cache = &data->cache;
+	len = ft_strlen(data->input);
+	cache->hit = 0;
+	while (cache->hit < PARSE_CACHE_SIZE)
+	{
+		if (cache->entries[cache->hit].input
+			&& cache->entries[cache->hit].len == len
+			&& !ft_memcmp(cache->entries[cache->hit].input, data->input, len))
+		{
+			cache->hits++;
+			return (trace_call(data, PH_TOKENS, use_cached_tokens));
+		}
+		cache->hit++;
+	}
+	cache->misses++;
+	return (trace_call(data, PH_QUOTES, is_quotation_closed)
+		&& trace_call(data, PH_TOKENS, tokenize_and_store));
+}
+
+/**
+Used in free_data().
+
+Frees all entries of the parse cache.
+*/
+void	free_parse_cache(t_parse_cache *cache)
+{
+	int	i;
+
+	i = 0;
+	while (i < PARSE_CACHE_SIZE)
+	{
+		free(cache->entries[i].input);
+		cache->entries[i].input = NULL;
+		ft_lstclear(&cache->entries[i].tokens, del_token);
+		i++;
+	}
+}
@@ -0,0 +1,88 @@
+/**
+This file contains utility functions for the parse cache (see
+tokenizer_cache.c): copying token lists in and out of it and choosing the
+entry to be replaced.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+t_list			*copy_tokens(t_list *src, t_list *end);
+t_cache_entry	*get_lru_entry(t_parse_cache *cache);
+
+/**
+Used in copy_tokens().
+
+Copies a token, including its lexeme, into a new list node.
+
+ @return	The new node, or `NULL` on malloc failure.
+*/
+static t_list	*copy_token(t_token *src)
+{
+	t_token	*token;
+	t_list	*node;
+
+	token = malloc(sizeof(t_token));
+	if (!token)
+		return (NULL);
+	*token = *src;
+	token->lexeme = ft_strdup(src->lexeme);
+	node = NULL;
+	if (token->lexeme)
+		node = ft_lstnew(token);
+	if (!node)
+		del_token(token);
+	return (node);
+}
+
+/**
+Copies a list of tokens, including their lexemes, up to (not including) the
+node `end`.
+
+ @param src 	The list to copy.
+ @param end 	The node to stop at, `NULL` to copy the whole list.
+
+ @return	The copy, or `NULL` on malloc failure (or if there was nothing to
+			copy).
+*/
+t_list	*copy_tokens(t_list *src, t_list *end)
+{
+	t_list	*head;
+	t_list	**tail;
+
+	head = NULL;
+	tail = &head;
+	while (src && src != end)
+	{
+		*tail = copy_token((t_token *)src->content);
+		if (!*tail)
+		{
+			ft_lstclear(&head, del_token);
+			return (NULL);
+		}
+		tail = &(*tail)->next;
+		src = src->next;
+	}
+	return (head);
+}
+
+/**
+Returns the entry of the cache to store a new line in: the first unused one
+or, if all are used, the least recently used one.
+*/
+t_cache_entry	*get_lru_entry(t_parse_cache *cache)
+{
+	t_cache_entry	*entry;
+	int				i;
+
+	entry = &cache->entries[0];
+	i = 0;
+	while (++i < PARSE_CACHE_SIZE && entry->input)
+	{
+		if (!cache->entries[i].input
+			|| cache->entries[i].used < entry->used)
+			entry = &cache->entries[i];
+	}
+	return (entry);
+}
@@ -18,7 +18,7 @@ Mostly a simplified version of is_valid_operand() in tokenizer_redirection.c.
 
 Scans the input string starting from the current index (*i).
 Skips any leading whitespace and checks if the encountered character is valid.
-Valid syntax after a pipe: Anything but '|' and end of input ('\0').
+Valid syntax after a pipe: Anything but '|', ';' and end of input ('\0').
 
  @param inp 	The input string containing the command line input.
  @param i 		The current index in the input string.
@@ -39,7 +39,8 @@ static char	*is_valid_syntax(t_data *data, int j)
 	while (is_whitespace(data->input[j]))
 		j++;
 	if (data->input[j] == '|' || data->input[j] == '&'
-		|| data->input[j] == '!' || data->input[j] == '\0')
+		|| data->input[j] == '!' || data->input[j] == ';'
+		|| data->input[j] == '\0')
 	{
 		invalid_syn = malloc(sizeof(char) * (ft_strlen("newline") + 1));
 		if (!invalid_syn)
@@ -121,14 +122,14 @@ static int	check_syntax(t_data *data, int j)
 	char	*str_j;
 
 	invalid_syn = is_valid_syntax(data, j);
-	if (invalid_syn != NULL || data->tok.tok_lst == NULL)
+	if (invalid_syn != NULL || is_command_start(data))
 	{
 		str_j = ft_itoa(j);
 		if (!str_j)
 			str_j = "-1";
 		if (ft_strcmp(str_j, "-1") == 0)
 			print_err_msg(ERR_MALLOC);
-		if (data->tok.tok_lst == NULL)
+		if (is_command_start(data))
 			print_pipe_err_msg(invalid_syn, str_j, data, 1);
 		else
 		{
@@ -146,7 +147,7 @@ static int	check_syntax(t_data *data, int j)
 /**
 If the character at index *i in the input string is a pipe symbol ('|'),
 the function checks if the syntax before and after the '|' is valid.
-Input before and after a pipe cannot be empty.
+Input before and after a pipe cannot be empty (nor a ';').
 Our minishell interprets '||' as "empty input between pipes" not as
 "OR" operator.
 
@@ -176,7 +177,7 @@ int	is_pipe(t_data *data, int *i)
 				free_unlinked_token(data);
 				return (0);
 			}
-			ft_lstadd_back(&data->tok.tok_lst, data->tok.new_node);
+			add_token(data);
 			return (1);
 		}
 		else
@@ -16,10 +16,12 @@ Used in check_operand().
 
 Scans the input string starting from the current index (*i).
 Skips any leading whitespace and checks if the encountered character is valid.
-Valid redirections are: `>`, `>>`, `<`, `<<`.
+Valid redirections are: `>`, `>>`, `<`, `<<`, `<<<`, `<>`, `>|`, `<&`, `>&`,
+`&>` and `&>>`, optionally prefixed by a fd number (e.g. `2>`, `2>&1`).
 Redirection cannot be the last part of the input string, a valid operand
 is needed.
-Valid operands (files) cannot be or start with `>`, `<`, or `|`.
+Valid operands (files) cannot be or start with `>`, `<`, `|` or `;`, except
+for process substitutions (e.g. `< <(ls)`).
 
  @param inp 	The input string containing the command line input.
  @param i 		The current index in the input string.
@@ -38,7 +40,8 @@ static char	*is_valid_operand(const char *inp, int *i)
 	invalid_op = NULL;
 	while (is_whitespace(inp[j]))
 		j++;
-	if (inp[j] == '>' || inp[j] == '<' || inp[j] == '|' || inp[j] == '\0')
+	if (((inp[j] == '>' || inp[j] == '<') && inp[j + 1] != '(')
+		|| inp[j] == '|' || inp[j] == ';' || inp[j] == '\0')
 	{
 		invalid_op = malloc(sizeof(char) * 8);
 		if (!invalid_op)
@@ -64,22 +67,17 @@ and updates the `errno` accordingly.
  @param invalid_op 	The invalid operand encountered in the input.
  @param input 		The input string containing the command line input.
  @param str_j 		The string representation of int j.
- @param j 			Position index of the failed redirection in the input string.
+ @param op 			The redirection operator (including a leading fd number).
 */
 static void	print_redir_err_msg(char *invalid_op, t_data *data,
-	char *str_j, int j)
+	char *str_j, const char *op)
 {
 	ft_putstr_fd(ERR_COLOR, STDERR_FILENO);
 	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
 	ft_putstr_fd(ERR_SYNTAX, STDERR_FILENO);
-	if (data->input[j] == '>' && data->input[j + 1] == '>')
-		ft_putstr_fd("'>>': '", STDERR_FILENO);
-	else if (data->input[j] == '>')
-		ft_putstr_fd("'>': '", STDERR_FILENO);
-	else if (data->input[j] == '<' && data->input[j + 1] == '<')
-		ft_putstr_fd("'<<': '", STDERR_FILENO);
-	else if (data->input[j] == '<')
-		ft_putstr_fd("'<': '", STDERR_FILENO);
+	ft_putstr_fd("'", STDERR_FILENO);
+	ft_putstr_fd((char *)op, STDERR_FILENO);
+	ft_putstr_fd("': '", STDERR_FILENO);
 	ft_putstr_fd(invalid_op, STDERR_FILENO);
 	ft_putstr_fd("' (position: ", STDERR_FILENO);
 	ft_putstr_fd(str_j, STDERR_FILENO);
@@ -100,11 +98,12 @@ in these cases).
  @param input 	The input string containing the command line input.
  @param i 		Pointer to the current index in the input string.
  @param j 		The index of the redirection operator in the input string.
+ @param op 		The redirection operator (including a leading fd number).
 
  @return	`0` if an invalid operand is found and an error message is printed.
 			`1` if the operand is valid.
 */
-static int	check_operand(t_data *data, int *i, int j)
+static int	check_operand(t_data *data, int *i, int j, const char *op)
 {
 	char	*invalid_op;
 	char	*str_j;
@@ -117,12 +116,12 @@ static int	check_operand(t_data *data, int *i, int j)
 			print_err_msg(ERR_MALLOC);
 		if (!str_j)
 		{
-			print_redir_err_msg(invalid_op, data, "-1", j);
+			print_redir_err_msg(invalid_op, data, "-1", op);
 			if (ft_strcmp(invalid_op, "ERR") != 0)
 				free(invalid_op);
 			return (0);
 		}
-		print_redir_err_msg(invalid_op, data, str_j, j);
+		print_redir_err_msg(invalid_op, data, str_j, op);
 		if (ft_strcmp(invalid_op, "ERR") != 0)
 			free(invalid_op);
 		free(str_j);
@@ -153,12 +152,15 @@ static int	create_redirection_token(t_data *data, int *i, t_token_type type,
 		free_unlinked_token(data);
 		return (0);
 	}
-	ft_lstadd_back(&data->tok.tok_lst, data->tok.new_node);
+	add_token(data);
 	return (1);
 }
 
 /**
 Checks for redirection operators in the input string starting from index *i.
+A redirection operator can be prefixed by the fd number it applies to
+(e.g. `2>`), digits are only part of the operator if they are directly
+followed by `<` or `>`.
 If a redirection operator is found, it creates the corresponding token and adds
 it to the token list. It also checks for a valid operand (file) after the
 redirection operator.
@@ -173,24 +175,28 @@ redirection operator.
 */
 int	is_redirection(t_data *data, int *i)
 {
-	int	j;
-	int	token_created;
+	t_token_type	type;
+	char			*op;
+	int				op_len;
+	int				j;
 
 	j = *i;
-	if (data->input[*i] == '>' && data->input[*i + 1] == '>')
-		token_created = create_redirection_token(data, i, APPEND_OUT, ">>");
-	else if (data->input[*i] == '>')
-		token_created = create_redirection_token(data, i, REDIR_OUT, ">");
-	else if (data->input[*i] == '<' && data->input[*i + 1] == '<')
-		token_created = create_redirection_token(data, i, HEREDOC, "<<");
-	else if (data->input[*i] == '<')
-		token_created = create_redirection_token(data, i, REDIR_IN, "<");
-	if (j != *i)
-	{
-		if (!check_operand(data, i, j))
-			return (-1);
-		if (token_created == 0)
-			return (0);
-	}
+	while (ft_isdigit(data->input[j]))
+		j++;
+	if (j > *i && data->input[j] != '<' && data->input[j] != '>')
+		return (1);
+	op_len = get_redirection_op(&data->input[j], &type);
+	if (!op_len)
+		return (1);
+	op = ft_strndup(data->input + *i, j - *i + op_len);
+	if (!op)
+		return (0);
+	j = *i;
+	op_len = create_redirection_token(data, i, type, op);
+	free(op);
+	if (!op_len)
+		return (0);
+	if (!check_operand(data, i, j, data->tok.tok->lexeme))
+		return (-1);
 	return (1);
 }
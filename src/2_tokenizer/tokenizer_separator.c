@@ -0,0 +1,42 @@
+/**
+This file contains a function to check the input string for a command
+separator (';' or a newline) and to create the corresponding token. Whether
+the separator is at a valid place (e.g. not at the start of a list), is
+checked when the command list is parsed (see parser_compound.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	is_separator(t_data *data, int *i);
+
+/**
+If the character at index *i in the input string is a ';' or a newline, it
+creates a SEPARATOR token and adds it to the token list. A newline only
+occurs in a command list which was continued on the next line (see
+read_continuation()).
+
+ @param data 	Data structure containing input string and token list.
+ @param i 		Pointer to the current index in the input string.
+
+ @return	`1` if a separator token was added to the token list or if
+ 			input[*i] is not a separator.
+ 			`0` if token creation failed (malloc failure).
+*/
+int	is_separator(t_data *data, int *i)
+{
+	if (data->input[*i] != ';' && data->input[*i] != '\n')
+		return (1);
+	if (data->input[*i] == ';')
+		data->tok.new_node = create_tok(data, SEPARATOR, ";", i);
+	else
+		data->tok.new_node = create_tok(data, SEPARATOR, "\n", i);
+	if (!data->tok.new_node)
+	{
+		free_unlinked_token(data);
+		return (0);
+	}
+	add_token(data);
+	return (1);
+}
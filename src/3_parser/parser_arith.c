@@ -0,0 +1,110 @@
+/**
+This file contains functions for arithmetic expansion: `$(( expr ))` is
+replaced with the value of the expression (see parser_arith_eval.c), e.g.
+`$(( i + 1 ))`. Variables in the expression are expanded first, so `$x`
+and `x` both work.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	arith_end(const char *str, int i);
+int	expand_arithmetic(char **str, int *i, t_data *data);
+int	arith_eval(t_data *data, const char *expr, long *result);
+
+/**
+Checks if an arithmetic expansion starts at index `i` of the string, i.e.
+`$((`, and finds its end: the `))` closing it. Parentheses within the
+expression have to be balanced.
+
+ @param str 	The string.
+ @param i 		The index of the `$`.
+
+ @return	The index after the closing `))`, or `0` if there is no
+			(complete) arithmetic expansion.
+*/
+int	arith_end(const char *str, int i)
+{
+	int	depth;
+
+	if (str[i] != '$' || str[i + 1] != '(' || str[i + 2] != '(')
+		return (0);
+	i += 2;
+	depth = 0;
+	while (str[i])
+	{
+		if (str[i] == '(')
+			depth++;
+		else if (str[i] == ')')
+			depth--;
+		if (depth == 0 && str[i + 1] == ')')
+			return (i + 2);
+		if (depth == 0)
+			return (0);
+		i++;
+	}
+	return (0);
+}
+
+/**
+Used in process_variable().
+
+Replaces the arithmetic expansion at index `*i` of the string (see
+arith_end()) with the value of its expression.
+
+ @param str 	Pointer to the string, which is replaced by a new one.
+ @param i 		Pointer to the index of the `$`, moved to the last character
+				of the value.
+ @param data 	Pointer to the data struct.
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if the expression is invalid (an error message was printed).
+*/
+int	expand_arithmetic(char **str, int *i, t_data *data)
+{
+	t_strbuf	sb;
+	char		*expr;
+	long		value;
+	int			end;
+	int			ret;
+
+	end = arith_end(*str, *i);
+	expr = ft_substr(*str, *i + 3, end - *i - 5);
+	if (!expr)
+		return (0);
+	ret = expand_nested(&expr, data);
+	if (ret > 0 && !arith_eval(data, expr, &value))
+		ret = -1;
+	free(expr);
+	if (ret <= 0)
+		return (ret);
+	ft_sb_init(&sb);
+	ret = (ft_sb_addnbr(&sb, value) && replace_range(str, *i, end, sb.buf));
+	*i += sb.len - 1;
+	ft_sb_free(&sb);
+	return (ret);
+}
+
+/**
+Evaluates an arithmetic expression (see parser_arith_eval.c), e.g. for
+`$(( expr ))` or an argument of `let`.
+
+ @param data 	Pointer to the data struct.
+ @param expr 	The expression.
+ @param result 	Set to the value of the expression.
+
+ @return	`1` on success.
+			`0` if the expression is invalid (an error message was printed
+			and the exit status set to `1`).
+*/
+int	arith_eval(t_data *data, const char *expr, long *result)
+{
+	t_arith	a;
+
+	ft_bzero(&a, sizeof(t_arith));
+	a.data = data;
+	a.expr = expr;
+	return (arith_eval_expr(&a, result));
+}
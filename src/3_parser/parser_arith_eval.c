@@ -0,0 +1,175 @@
+/**
+This file contains the evaluator of arithmetic expressions, as in
+`$(( expr ))` and `let`. It works on the expression string directly, without
+building a syntax tree, by precedence climbing: an operand (see
+parser_arith_operand.c) is followed by binary operators, and the right side
+of each operator extends as long as the operators there bind tighter.
+
+From the loosest to the tightest binding, the operators are:
+ - `,` (only at the top level), `=` and compound assignments like `+=`,
+ - `? :`, `||`, `&&`, `|`, `^`, `&`, `==` `!=`, `<` `<=` `>` `>=`,
+ - `<<` `>>`, `+` `-`, `*` `/` `%`, `**`,
+ - the unary operators and `++` / `--` (see parser_arith_operand.c).
+
+Variables are environment variables (minishell has no shell variables); an
+unset or empty variable is `0`. The whole evaluation happens in the shell
+itself, without forking e.g. `expr`.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+long	arith_assign(t_arith *a);
+int		arith_eval_expr(t_arith *a, long *result);
+
+/**
+Used in arith_assign().
+
+Checks if the expression continues with an assignment, i.e. a variable name
+followed by `=` or a compound assignment operator, and evaluates it.
+
+ @return	`1` if there was an assignment (its value is stored in `value`),
+			`0` otherwise (the position is unchanged).
+*/
+static int	try_assign(t_arith *a, long *value)
+{
+	const char	*op;
+	char		*name;
+	int			start;
+	int			len;
+
+	*value = 0;
+	start = a->pos;
+	while (ft_isalnum(a->expr[a->pos]) || a->expr[a->pos] == '_')
+		a->pos++;
+	len = arith_assign_op(a, &op);
+	a->pos = start;
+	if (!len || !(ft_isalpha(a->expr[start]) || a->expr[start] == '_'))
+		return (0);
+	name = arith_read_name(a);
+	if (!name)
+		return (1);
+	arith_skip_space(a);
+	a->pos += len;
+	*value = arith_assign(a);
+	if (*op)
+		*value = arith_apply(a, op, arith_get_var(a, name), *value);
+	arith_set_var(a, name, *value);
+	free(name);
+	return (1);
+}
+
+/**
+Used in parse_conditional().
+
+Evaluates operands joined by binary operators with a precedence of at least
+`min_precedence` (see arith_binary_op()). The right side of `&&` and `||` is
+only parsed if the left side already decides the result.
+*/
+static long	parse_binary(t_arith *a, int min_precedence)
+{
+	const char	*op;
+	long		lhs;
+	long		rhs;
+	int			precedence;
+	int			skip;
+
+	lhs = arith_operand(a);
+	precedence = arith_binary_op(a, &op);
+	while (!a->error && precedence >= min_precedence)
+	{
+		a->pos += ft_strlen(op);
+		skip = ((!ft_strcmp(op, "&&") && !lhs) || (!ft_strcmp(op, "||")
+					&& lhs));
+		a->noeval += skip;
+		if (!ft_strcmp(op, "**"))
+			rhs = parse_binary(a, precedence);
+		else
+			rhs = parse_binary(a, precedence + 1);
+		a->noeval -= skip;
+		lhs = arith_apply(a, op, lhs, rhs);
+		precedence = arith_binary_op(a, &op);
+	}
+	return (lhs);
+}
+
+/**
+Used in arith_assign().
+
+Evaluates a conditional expression `cond ? expr : expr`, or only the binary
+operators if there is no `?`. Only the chosen branch is evaluated.
+*/
+static long	parse_conditional(t_arith *a)
+{
+	long	cond;
+	long	value;
+	long	other;
+
+	cond = parse_binary(a, 1);
+	arith_skip_space(a);
+	if (a->error || a->expr[a->pos] != '?')
+		return (cond);
+	a->pos++;
+	a->noeval += (cond == 0);
+	value = arith_assign(a);
+	a->noeval -= (cond == 0);
+	arith_skip_space(a);
+	if (a->error || a->expr[a->pos] != ':')
+		return (arith_error(a, ERR_ARITH_COLON, a->pos));
+	a->pos++;
+	a->noeval += (cond != 0);
+	other = parse_conditional(a);
+	a->noeval -= (cond != 0);
+	if (cond)
+		return (value);
+	return (other);
+}
+
+/**
+Evaluates an expression without `,`: an assignment or a conditional
+expression.
+
+ @param a 	The state of the evaluation.
+
+ @return	The value of the expression (`0` on an error).
+*/
+long	arith_assign(t_arith *a)
+{
+	long	value;
+
+	arith_skip_space(a);
+	if (try_assign(a, &value))
+		return (value);
+	return (parse_conditional(a));
+}
+
+/**
+Evaluates a whole expression: assignments or conditional expressions,
+separated by `,`. Its value is the one of the last of them; an empty
+expression is `0`.
+
+ @param a 		The state of the evaluation.
+ @param result 	Set to the value of the expression.
+
+ @return	`1` on success.
+			`0` on an error (an error message was printed).
+*/
+int	arith_eval_expr(t_arith *a, long *result)
+{
+	*result = 0;
+	arith_skip_space(a);
+	if (!a->expr[a->pos])
+		return (1);
+	*result = arith_assign(a);
+	arith_skip_space(a);
+	while (!a->error && a->expr[a->pos] == ',')
+	{
+		a->pos++;
+		*result = arith_assign(a);
+		arith_skip_space(a);
+	}
+	if (!a->error && a->expr[a->pos])
+		arith_error(a, ERR_ARITH_SYNTAX, a->pos);
+	return (!a->error);
+}
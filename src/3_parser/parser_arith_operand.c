@@ -0,0 +1,158 @@
+/**
+This file contains functions to read the operands of arithmetic expressions
+(see parser_arith_eval.c): numbers, variables (with `++` / `--` before or
+after them), unary operators and parenthesized expressions.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+long	arith_operand(t_arith *a);
+
+/**
+Used in arith_operand().
+
+Reads a number: decimal, octal if it starts with `0`, hexadecimal if it
+starts with `0x`.
+*/
+static long	read_number(t_arith *a)
+{
+	unsigned long	value;
+	int				base;
+	int				digit;
+	char			c;
+
+	base = 10;
+	if (a->expr[a->pos] == '0')
+		base = 8;
+	if (base == 8 && ft_tolower(a->expr[a->pos + 1]) == 'x')
+	{
+		base = 16;
+		a->pos += 2;
+	}
+	value = 0;
+	while (ft_isalnum(a->expr[a->pos]))
+	{
+		c = ft_tolower(a->expr[a->pos++]);
+		digit = c - '0';
+		if (!ft_isdigit(c))
+			digit = c - 'a' + 10;
+		if (digit >= base)
+			return (arith_error(a, ERR_ARITH_BASE, a->tok));
+		value = value * base + digit;
+	}
+	return ((long)value);
+}
+
+/**
+Used in arith_operand().
+
+Reads a variable, which is incremented or decremented after its value was
+read if `++` or `--` follows.
+*/
+static long	read_variable(t_arith *a)
+{
+	char	*name;
+	long	value;
+
+	name = arith_read_name(a);
+	if (!name)
+		return (0);
+	value = arith_get_var(a, name);
+	if (!ft_strncmp(a->expr + a->pos, "++", 2))
+		arith_set_var(a, name, (long)((unsigned long)value + 1));
+	else if (!ft_strncmp(a->expr + a->pos, "--", 2))
+		arith_set_var(a, name, (long)((unsigned long)value - 1));
+	else
+	{
+		free(name);
+		return (value);
+	}
+	a->pos += 2;
+	free(name);
+	return (value);
+}
+
+/**
+Used in arith_operand().
+
+Reads a variable preceded by `++` or `--`, which is incremented or
+decremented before its value is used.
+*/
+static long	read_prefixed_variable(t_arith *a)
+{
+	char	*name;
+	long	value;
+	char	op;
+
+	op = a->expr[a->pos];
+	a->pos += 2;
+	name = arith_read_name(a);
+	if (!name)
+		return (0);
+	value = arith_get_var(a, name);
+	if (op == '+')
+		value = (long)((unsigned long)value + 1);
+	else
+		value = (long)((unsigned long)value - 1);
+	arith_set_var(a, name, value);
+	free(name);
+	return (value);
+}
+
+/**
+Used in arith_operand().
+
+Applies a unary operator (`+`, `-`, `!` or `~`) to the operand following it.
+*/
+static long	read_unary(t_arith *a, char op)
+{
+	long	value;
+
+	a->pos++;
+	value = arith_operand(a);
+	if (op == '-')
+		return ((long)(0UL - (unsigned long)value));
+	if (op == '!')
+		return (!value);
+	if (op == '~')
+		return (~value);
+	return (value);
+}
+
+/**
+Reads an operand of a binary operator, i.e. everything that binds tighter
+than the binary operators.
+
+ @param a 	The state of the evaluation.
+
+ @return	The value of the operand (`0` on an error).
+*/
+long	arith_operand(t_arith *a)
+{
+	long	value;
+	char	c;
+
+	arith_skip_space(a);
+	a->tok = a->pos;
+	c = a->expr[a->pos];
+	if ((c == '+' || c == '-') && a->expr[a->pos + 1] == c
+		&& (ft_isalpha(a->expr[a->pos + 2]) || a->expr[a->pos + 2] == '_'))
+		return (read_prefixed_variable(a));
+	if (c == '+' || c == '-' || c == '!' || c == '~')
+		return (read_unary(a, c));
+	if (ft_isdigit(c))
+		return (read_number(a));
+	if (ft_isalpha(c) || c == '_')
+		return (read_variable(a));
+	if (c != '(')
+		return (arith_error(a, ERR_ARITH_OPERAND, a->pos));
+	a->pos++;
+	value = arith_assign(a);
+	arith_skip_space(a);
+	if (a->error || a->expr[a->pos] != ')')
+		return (arith_error(a, ERR_ARITH_PAREN, a->pos));
+	a->pos++;
+	return (value);
+}
@@ -0,0 +1,127 @@
+/**
+This file contains utility functions for evaluating arithmetic expressions
+(see parser_arith_eval.c): skipping whitespace, reporting errors and reading
+and assigning variables.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	arith_skip_space(t_arith *a);
+long	arith_error(t_arith *a, const char *msg, int pos);
+char	*arith_read_name(t_arith *a);
+long	arith_get_var(t_arith *a, const char *name);
+void	arith_set_var(t_arith *a, const char *name, long value);
+
+/**
+Skips the whitespace at the current position of the expression.
+*/
+void	arith_skip_space(t_arith *a)
+{
+	while (is_whitespace(a->expr[a->pos]))
+		a->pos++;
+}
+
+/**
+Prints an error message for the expression, with the rest of the expression
+from `pos` as the token causing the error (like bash), and sets the exit
+status to `1`. Only the first error of an expression is reported.
+
+ @param a 		The state of the evaluation.
+ @param msg 	The error message.
+ @param pos 	The index of the token causing the error.
+
+ @return	`0`, so it can be returned as the value of the expression.
+*/
+long	arith_error(t_arith *a, const char *msg, int pos)
+{
+	if (a->error)
+		return (0);
+	a->error = 1;
+	a->data->exit_status = 1;
+	ft_putstr_fd(ERR_COLOR, STDERR_FILENO);
+	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
+	ft_putstr_fd((char *)a->expr, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd((char *)msg, STDERR_FILENO);
+	ft_putstr_fd(" (error token is \"", STDERR_FILENO);
+	ft_putstr_fd((char *)a->expr + pos, STDERR_FILENO);
+	ft_putstr_fd("\")\n", STDERR_FILENO);
+	ft_putstr_fd(RESET, STDERR_FILENO);
+	return (0);
+}
+
+/**
+Reads the name of a variable (letters, digits and underscores, not starting
+with a digit) at the current position of the expression.
+
+ @return	A copy of the name, or `NULL` on malloc failure (which stops the
+			evaluation).
+*/
+char	*arith_read_name(t_arith *a)
+{
+	int		start;
+	char	*name;
+
+	start = a->pos;
+	while (ft_isalnum(a->expr[a->pos]) || a->expr[a->pos] == '_')
+		a->pos++;
+	name = ft_strndup(a->expr + start, a->pos - start);
+	if (!name)
+	{
+		print_err_msg(ERR_MALLOC);
+		a->data->exit_status = 1;
+		a->error = 1;
+	}
+	return (name);
+}
+
+/**
+Returns the value of a variable in an expression: `0` if it is unset or
+empty, otherwise its value, which is evaluated as an expression itself (so
+`a=b` and `b=3` make `a` evaluate to `3`).
+*/
+long	arith_get_var(t_arith *a, const char *name)
+{
+	t_arith	sub;
+	char	*value;
+	long	result;
+
+	value = get_env_value(a->data->envp_temp, name);
+	if (!value || !*value)
+		return (0);
+	if (a->depth >= ARITH_MAX_DEPTH)
+		return (arith_error(a, ERR_ARITH_DEPTH, a->pos));
+	sub = *a;
+	sub.expr = value;
+	sub.pos = 0;
+	sub.depth++;
+	result = 0;
+	if (!arith_eval_expr(&sub, &result))
+		a->error = 1;
+	return (result);
+}
+
+/**
+Assigns a value to a variable of an expression (unless the expression is
+only parsed, see `t_arith`). As minishell has no shell variables, it is set
+in the environment.
+*/
+void	arith_set_var(t_arith *a, const char *name, long value)
+{
+	t_strbuf	sb;
+
+	if (a->noeval || a->error)
+		return ;
+	ft_sb_init(&sb);
+	if (!ft_sb_addnbr(&sb, value))
+	{
+		print_err_msg(ERR_MALLOC);
+		a->data->exit_status = 1;
+		a->error = 1;
+	}
+	else if (!set_env_var(a->data, name, sb.buf))
+		a->error = 1;
+	ft_sb_free(&sb);
+}
@@ -0,0 +1,146 @@
+/**
+This file contains functions to parse a command line into a list of commands
+(see `t_node`), if it contains control flow: commands separated by `;` or
+newlines and the compound commands `if`, `while`, `until` and `for` (see
+parser_compound_cmds.c).
+
+Each command is parsed once; its tokens are copied into the node as they are
+before expansion, so a loop body runs again and again without being
+tokenized or parsed again.
+
+The parsing functions return:
+ - `1`:		if the command (list) was parsed successfully;
+ - `0`:		on a syntax error or malloc failure (an error message was printed);
+ - `-1`:	if the tokens ended before the command was complete (e.g. `done`
+			is missing), so the next line of input is needed.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	expect_word(t_data *data, t_list **cur, const char *word);
+int	parse_list(t_data *data, t_list **cur, t_node **list);
+
+/**
+Checks if a token is a newline separating two commands. Newlines are only
+part of the input if a command list was continued on the next line.
+*/
+static int	is_newline(t_list *cur)
+{
+	t_token	*token;
+
+	if (!cur)
+		return (0);
+	token = (t_token *)cur->content;
+	return (token->type == SEPARATOR && ft_strcmp(token->lexeme, "\n") == 0);
+}
+
+/**
+Skips newlines and consumes the reserved word which has to follow, e.g.
+`then` after the condition of an `if`.
+
+ @param data 	Pointer to the data struct.
+ @param cur 	The current token, moved past the reserved word.
+ @param word 	The expected reserved word.
+
+ @return	`1` if the word was found, `0` on a syntax error, `-1` if the
+			tokens ended.
+*/
+int	expect_word(t_data *data, t_list **cur, const char *word)
+{
+	while (is_newline(*cur))
+		*cur = (*cur)->next;
+	if (!*cur)
+		return (-1);
+	if (!is_reserved_word(*cur, word))
+		return (syntax_error(data, *cur));
+	*cur = (*cur)->next;
+	return (1);
+}
+
+/**
+Used in parse_command().
+
+Parses a pipeline: copies its tokens up to the next separator into a new
+node, numbered from `0` as the execution expects.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	parse_simple(t_list **cur, t_node **node)
+{
+	t_list	*end;
+
+	*node = new_node(NODE_CMD);
+	if (!*node)
+		return (0);
+	end = *cur;
+	while (end && ((t_token *)end->content)->type != SEPARATOR)
+		end = end->next;
+	(*node)->tokens = copy_tokens(*cur, end);
+	if (!(*node)->tokens)
+	{
+		print_err_msg(ERR_MALLOC);
+		return (0);
+	}
+	number_tokens((*node)->tokens);
+	*cur = end;
+	return (1);
+}
+
+/**
+Used in parse_list().
+
+Parses a single command: a compound command if it starts with one of the
+reserved words `if`, `while`, `until` or `for`, otherwise a pipeline.
+*/
+static int	parse_command(t_data *data, t_list **cur, t_node **node)
+{
+	if (is_reserved_word(*cur, "if"))
+		return (parse_if(data, cur, node));
+	if (is_reserved_word(*cur, "while") || is_reserved_word(*cur, "until"))
+		return (parse_loop(data, cur, node));
+	if (is_reserved_word(*cur, "for"))
+		return (parse_for(data, cur, node));
+	if (((t_token *)(*cur)->content)->type == SEPARATOR)
+		return (syntax_error(data, *cur));
+	return (parse_simple(cur, node));
+}
+
+/**
+Parses a list of commands, separated by `;` or newlines, up to the end of
+the tokens or a reserved word closing the list (see is_list_end()), which is
+not consumed. Empty lines are skipped. A list closed by a reserved word
+must not be empty (e.g. `while do`, `then fi`), as in bash.
+
+ @param data 	Pointer to the data struct.
+ @param cur 	The current token, moved to the end of the list.
+ @param list 	Set to the first node of the list (`NULL` if it is empty).
+
+ @return	See the top of this file.
+*/
+int	parse_list(t_data *data, t_list **cur, t_node **list)
+{
+	t_node	**first;
+	int		ret;
+
+	first = list;
+	while (1)
+	{
+		while (is_newline(*cur))
+			*cur = (*cur)->next;
+		if (*cur && is_list_end(*cur) && list == first)
+			return (syntax_error(data, *cur));
+		if (is_list_end(*cur))
+			return (1);
+		ret = parse_command(data, cur, list);
+		if (ret <= 0)
+			return (ret);
+		list = &(*list)->next;
+		if (is_list_end(*cur))
+			return (1);
+		if (((t_token *)(*cur)->content)->type != SEPARATOR)
+			return (syntax_error(data, *cur));
+		*cur = (*cur)->next;
+	}
+}
@@ -0,0 +1,154 @@
+/**
+This file contains the directory scanner of pathname expansion (see
+parser_glob.c). The components of a pattern are resolved one directory level
+at a time: a literal component is appended to the path without reading any
+directory, a pattern is matched against the entries of the directory read
+with readdir(). Only entries which may be directories (according to their
+`d_type`, so no stat() call is needed) are descended into for the following
+components, other entries are pruned right away.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	glob_dir(t_glob *g, size_t i);
+
+/**
+Used in visit_entry().
+
+Checks if the name of a directory entry matches a component. A leading `.`
+has to be matched by a literal `.`, not by a wildcard, so hidden files are
+left out unless the pattern starts with `.`; `.` and `..` are never matched.
+*/
+static int	name_matches(const t_pattern *pat, const char *name)
+{
+	if (name[0] == '.' && (pat->elems[0].type != PAT_CHAR
+			|| pat->elems[0].c != '.'))
+		return (0);
+	if (!ft_strcmp(name, ".") || !ft_strcmp(name, ".."))
+		return (0);
+	return (pattern_match(pat, name, ft_strlen(name)));
+}
+
+/**
+Used in glob_dir() and visit_entry().
+
+Adds the current path to the matches, as a new token.
+*/
+static void	add_match(t_glob *g)
+{
+	t_token	*token;
+	t_list	*node;
+
+	token = ft_calloc(1, sizeof(t_token));
+	node = ft_lstnew(token);
+	if (token)
+		token->lexeme = ft_strdup(g->path.buf);
+	if (!token || !node || !token->lexeme)
+	{
+		del_token(token);
+		free(node);
+		g->error = true;
+		return ;
+	}
+	token->type = OTHER;
+	ft_lstadd_front(&g->matches, node);
+	g->found++;
+}
+
+/**
+Used in scan_dir().
+
+Matches a directory entry against component `i`. A match of the last
+component is added to the matches, otherwise the entry is descended into.
+Entries which are known to be no directory are skipped before matching if
+more components follow.
+*/
+static void	visit_entry(t_glob *g, size_t i, struct dirent *entry)
+{
+	size_t	len;
+
+	if (i + 1 < g->count && entry->d_type != DT_DIR
+		&& entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN)
+		return ;
+	if (!name_matches(g->pats[i], entry->d_name))
+		return ;
+	len = g->path.len;
+	if (!ft_sb_adds(&g->path, entry->d_name))
+		g->error = true;
+	else if (i + 1 == g->count)
+		add_match(g);
+	else if (!ft_sb_addc(&g->path, '/'))
+		g->error = true;
+	else
+		glob_dir(g, i + 1);
+	g->path.len = len;
+	g->path.buf[len] = '\0';
+}
+
+/**
+Used in glob_dir().
+
+Reads the directory of the current path (the current directory if it is
+empty) and matches its entries against component `i`. A directory which
+cannot be opened has no matches.
+*/
+static void	scan_dir(t_glob *g, size_t i)
+{
+	DIR				*dir;
+	struct dirent	*entry;
+
+	if (g->path.len)
+		dir = opendir(g->path.buf);
+	else
+		dir = opendir(".");
+	if (!dir)
+		return ;
+	entry = readdir(dir);
+	while (entry && !g->error)
+	{
+		visit_entry(g, i, entry);
+		entry = readdir(dir);
+	}
+	closedir(dir);
+}
+
+/**
+Used in expand_glob().
+
+Resolves the components of a pattern from component `i` on, relative to the
+current path, and adds every existing path matching them to the matches. The
+literal components at the end of a pattern (e.g. `Makefile` of
+`src?/Makefile`) are only checked for existence once, after the last one.
+
+ @param g 	The pathname expansion.
+ @param i 	The index of the next component.
+*/
+void	glob_dir(t_glob *g, size_t i)
+{
+	size_t	len;
+	size_t	k;
+
+	if (i == g->count)
+	{
+		if (access(g->path.buf, F_OK) == 0)
+			add_match(g);
+		return ;
+	}
+	if (g->pats[i]->magic)
+	{
+		scan_dir(g, i);
+		return ;
+	}
+	len = g->path.len;
+	k = 0;
+	while (k < g->pats[i]->count && !g->error)
+		g->error = !ft_sb_addc(&g->path, g->pats[i]->elems[k++].c);
+	if (!g->error && i + 1 < g->count)
+		g->error = !ft_sb_addc(&g->path, '/');
+	if (!g->error)
+		glob_dir(g, i + 1);
+	g->path.len = len;
+	g->path.buf[len] = '\0';
+}
@@ -42,8 +42,9 @@ static int	write_to_fd(int fd, char **input_line)
 /**
 Used in handle_heredoc_input().
 
-Reads a line of input from stdin, optionally processes it to perform
-variable expansion, and trims the newline character.
+Reads a line of input from stdin (or the script, or the lines read ahead, see
+collect_heredocs()), optionally processes it to perform variable expansion,
+and trims the newline character.
 
  @param input_line 	A pointer to a string that will be allocated and populated
  					with the line of input read from stdin.
@@ -60,13 +61,21 @@ static int	read_and_process_line(char **input_line, t_data *data,
 {
 	int	expansion_result;
 
-	*input_line = readline(HEREDOC_P);
+	if (data->heredoc_lines)
+		*input_line = next_heredoc_line(data);
+	else if (data->interactive)
+	{
+		*input_line = readline(HEREDOC_P);
+		ft_ms_adopt(*input_line);
+	}
+	else
+		*input_line = read_script_line(data);
 	if (!*input_line)
 		return (2);
 	if (expansion)
 	{
 		expansion_result = expand_variables(input_line, data, 1);
-		if (!expansion_result)
+		if (expansion_result <= 0)
 		{
 			free(*input_line);
 			return (0);
@@ -0,0 +1,164 @@
+/**
+This file contains the reading of heredoc bodies within a command list which
+spans several lines (see parser_program.c): as in bash, the body of a heredoc
+follows the line with its operator, before the next line of the list. The
+lines are queued in `data->heredoc_lines` and kept with their commands once
+the list is complete (see parser_heredoc_keep.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int		collect_heredocs(t_data *data);
+char	*next_heredoc_line(t_data *data);
+
+/**
+Used in queue_body().
+
+Reads the next line of a heredoc body: via readline() with the heredoc prompt
+in interactive mode, otherwise from the script.
+
+ @return	The line, or `NULL` at the end of the input or if the prompt was
+			interrupted by CTRL + C.
+*/
+static char	*read_body_line(t_data *data)
+{
+	char	*line;
+
+	if (data->interactive)
+	{
+		line = readline(HEREDOC_P);
+		ft_ms_adopt(line);
+	}
+	else
+		line = read_script_line(data);
+	if (g_signal)
+	{
+		free(line);
+		return (NULL);
+	}
+	return (line);
+}
+
+/**
+Used in collect_heredocs().
+
+Reads the body of a heredoc up to the line with its delimiter, which is
+queued as well, so process_heredocs() finds the end of the body as usual.
+
+ @param data 		Pointer to the data struct.
+ @param tail 		Pointer to the `next` pointer of the last queued line,
+ 					moved along.
+ @param delimiter 	The delimiter, with paired quotes removed.
+
+ @return	`1` on success or at the end of the input.
+			`0` on malloc failure or if interrupted by CTRL + C.
+*/
+static int	queue_body(t_data *data, t_list ***tail, char *delimiter)
+{
+	t_list	*node;
+	char	*line;
+
+	line = read_body_line(data);
+	while (line)
+	{
+		node = ft_lstnew(line);
+		if (!node)
+		{
+			free(line);
+			return (0);
+		}
+		**tail = node;
+		*tail = &node->next;
+		if (ft_strcmp(line, delimiter) == 0)
+			return (1);
+		line = read_body_line(data);
+	}
+	return (!g_signal);
+}
+
+/**
+Used in collect_heredocs().
+
+Finds the tokens of the last line of a command list: the line starts after
+the last newline separator (see is_separator()).
+
+ @param cur 	The token list.
+
+ @return	The first token of the last line, `NULL` if it has none.
+*/
+static t_list	*last_line(t_list *cur)
+{
+	t_list	*start;
+	t_token	*token;
+
+	start = cur;
+	while (cur)
+	{
+		token = cur->content;
+		if (token->type == SEPARATOR && token->lexeme[0] == '\n')
+			start = cur->next;
+		cur = cur->next;
+	}
+	return (start);
+}
+
+/**
+Used in read_continuation() and parse_program().
+
+Reads the bodies of the heredocs on the last line of a command list, in the
+order they appear, before the next line of the list is read. The bodies of
+the heredocs on the lines before were read already.
+
+ @param data 	Pointer to the data struct containing the token list.
+
+ @return	`1` on success, `0` on malloc failure (an error message was
+			printed) or if interrupted by CTRL + C.
+*/
+int	collect_heredocs(t_data *data)
+{
+	t_list	**tail;
+	t_list	*cur;
+	char	*delim;
+	int		ret;
+
+	tail = &data->heredoc_lines;
+	while (*tail)
+		tail = &(*tail)->next;
+	cur = last_line(data->tok.tok_lst);
+	ret = 1;
+	while (cur && cur->next && ret)
+	{
+		if (((t_token *)cur->content)->type == HEREDOC)
+		{
+			delim = trim_paired_quotes(((t_token *)cur->next->content)->lexeme);
+			ret = (delim && queue_body(data, &tail, delim));
+			free(delim);
+		}
+		cur = cur->next;
+	}
+	if (!ret && !g_signal)
+		print_err_msg(ERR_MALLOC);
+	return (ret);
+}
+
+/**
+Used in read_and_process_line().
+
+Takes the next line of a heredoc body read ahead (see collect_heredocs()) from
+the queue, which must not be empty.
+
+ @return	The line, to be freed by the caller.
+*/
+char	*next_heredoc_line(t_data *data)
+{
+	t_list	*node;
+	char	*line;
+
+	node = data->heredoc_lines;
+	data->heredoc_lines = node->next;
+	line = node->content;
+	free(node);
+	return (line);
+}
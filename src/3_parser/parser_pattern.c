@@ -0,0 +1,153 @@
+/**
+This file contains functions to compile glob patterns (`*`, `?` and bracket
+expressions like `[a-z]`), as used by parameter expansions like
+`${NAME#pattern}`. A pattern is compiled once into a list of elements (see
+`t_pattern`), which is then matched against strings by
+parser_pattern_match.c without looking at quotes or brackets again.
+
+Quoted characters of the pattern are literal, e.g. `"*"` only matches `*`.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+t_pattern	*pattern_compile(const char *word);
+void		pattern_free(t_pattern *pat);
+
+/**
+Used in parse_class().
+
+Adds the characters from `first` to `last` to the set of a bracket
+expression.
+*/
+static void	add_range(t_pat_elem *elem, unsigned char first, unsigned char last)
+{
+	unsigned int	c;
+
+	c = first;
+	while (c <= last)
+	{
+		elem->set[c / 8] |= 1 << (c % 8);
+		c++;
+	}
+}
+
+/**
+Used in compile_char().
+
+Parses a bracket expression starting at `word[i]` (the `[`) into a set of
+characters: single characters and ranges like `a-z`, inverted if it starts
+with `!` or `^`. A `]` right after the opening bracket is part of the set.
+
+ @return	The index of the closing `]`, or `0` if there is none (then the
+			`[` is a literal character).
+*/
+static size_t	parse_class(t_pat_elem *elem, const char *word, size_t i)
+{
+	size_t	start;
+	size_t	len;
+	bool	negate;
+
+	negate = (word[++i] == '!' || word[i] == '^');
+	i += negate;
+	start = i;
+	while (word[i] && (word[i] != ']' || i == start))
+	{
+		len = 0;
+		if (word[i + 1] == '-' && word[i + 2] && word[i + 2] != ']')
+			len = 2;
+		add_range(elem, word[i], word[i + len]);
+		i += len + 1;
+	}
+	if (!word[i])
+		return (0);
+	start = 0;
+	while (negate && start < sizeof(elem->set))
+		elem->set[start++] ^= 0xff;
+	elem->type = PAT_CLASS;
+	return (i);
+}
+
+/**
+Used in pattern_compile().
+
+Compiles the unquoted character at `word[i]` into the next element of the
+pattern: `*`, `?`, a bracket expression or a literal character.
+
+ @return	The index of the next character to compile.
+*/
+static size_t	compile_char(t_pattern *pat, const char *word, size_t i)
+{
+	t_pat_elem	*elem;
+	size_t		end;
+
+	elem = &pat->elems[pat->count];
+	end = 0;
+	if (word[i] == '*' && pat->count > 0 && elem[-1].type == PAT_STAR)
+		return (i + 1);
+	if (word[i] == '*')
+		elem->type = PAT_STAR;
+	else if (word[i] == '?')
+		elem->type = PAT_ANY;
+	else if (word[i] == '[')
+		end = parse_class(elem, word, i);
+	if (word[i] != '*' && word[i] != '?' && !end)
+	{
+		elem->type = PAT_CHAR;
+		elem->c = word[i];
+	}
+	else if (end)
+		i = end;
+	pat->magic = (pat->magic || elem->type != PAT_CHAR);
+	pat->count++;
+	return (i + 1);
+}
+
+/**
+Compiles a glob pattern.
+
+ @param word 	The pattern, with quotes (quoted characters are literal).
+
+ @return	The compiled pattern (to be freed with pattern_free()), or `NULL`
+			on malloc failure. Its elements are followed by a zeroed one, i.e.
+			a `PAT_CHAR` of `\0`, which ends the matching. The elements and
+			the space for matching beginnings and ends follow the struct in
+			the same allocation.
+*/
+t_pattern	*pattern_compile(const char *word)
+{
+	t_pattern	*pat;
+	t_quote		quote;
+	size_t		len;
+	size_t		i;
+
+	len = ft_strlen(word) + 1;
+	pat = ft_calloc(1, sizeof(t_pattern) + len * (sizeof(t_pat_elem) + 2));
+	if (!pat)
+		return (NULL);
+	pat->elems = (t_pat_elem *)(pat + 1);
+	pat->states = (unsigned char *)(pat->elems + len);
+	ft_bzero(&quote, sizeof(t_quote));
+	i = 0;
+	while (word[i])
+	{
+		if (process_quote(word[i], &quote.in_single, &quote.in_double))
+			i++;
+		else if (quote.in_single || quote.in_double)
+			pat->elems[pat->count++].c = word[i++];
+		else
+			i = compile_char(pat, word, i);
+	}
+	return (pat);
+}
+
+/**
+Frees a compiled pattern.
+
+ @param pat 	The pattern (may be `NULL`).
+*/
+void	pattern_free(t_pattern *pat)
+{
+	free(pat);
+}
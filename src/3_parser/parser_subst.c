@@ -0,0 +1,107 @@
+/**
+This file contains functions for command substitution: `$(command)` and
+`` `command` `` are replaced with the output of the command (see
+execution_subst.c), without its trailing newlines. The output is not
+expanded again.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	paren_end(const char *str, int i);
+int	subst_end(const char *str, int i);
+int	expand_command(char **str, int *i, t_data *data);
+
+/**
+Finds the `)` closing the `(` at index `i` of the string. Parentheses within
+quotations are skipped, others have to be balanced.
+
+ @param str 	The string.
+ @param i 		The index of the `(`.
+
+ @return	The index after the closing `)`, or `0` if there is none.
+*/
+int	paren_end(const char *str, int i)
+{
+	int	depth;
+
+	depth = 0;
+	while (str[i])
+	{
+		if ((str[i] == '\'' || str[i] == '\"')
+			&& ft_strchr(str + i + 1, str[i]))
+			i = ft_strchr(str + i + 1, str[i]) - str;
+		else if (str[i] == '(')
+			depth++;
+		else if (str[i] == ')')
+			depth--;
+		i++;
+		if (depth == 0)
+			return (i);
+	}
+	return (0);
+}
+
+/**
+Checks if a command substitution starts at index `i` of the string, i.e.
+`$(` or a backtick, and finds its end: the `)` closing it (see paren_end())
+or the next backtick.
+
+ @param str 	The string.
+ @param i 		The index of the `$` or the backtick.
+
+ @return	The index after the closing `)` or backtick, or `0` if there is no
+			(complete) command substitution.
+*/
+int	subst_end(const char *str, int i)
+{
+	if (str[i] == '`' && ft_strchr(str + i + 1, '`'))
+		return (ft_strchr(str + i + 1, '`') - str + 1);
+	if (str[i] != '$' || str[i + 1] != '(')
+		return (0);
+	return (paren_end(str, i + 1));
+}
+
+/**
+Used in process_variable().
+
+Replaces the command substitution at index `*i` of the string (see
+subst_end()) with the output of its command, without trailing newlines. The
+exit status is the one of the command.
+
+ @param str 	Pointer to the string, which is replaced by a new one.
+ @param i 		Pointer to the index of the `$` or backtick, moved to the
+				last character of the output.
+ @param data 	Pointer to the data struct.
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if the command could not be run (an error message was
+			printed).
+*/
+int	expand_command(char **str, int *i, t_data *data)
+{
+	t_strbuf	out;
+	char		*cmd;
+	int			backtick;
+	int			end;
+	int			ret;
+
+	end = subst_end(*str, *i);
+	backtick = ((*str)[*i] == '`');
+	cmd = ft_substr(*str, *i + 2 - backtick, end - *i - 3 + backtick);
+	if (!cmd)
+		return (0);
+	ft_sb_init(&out);
+	ret = command_subst(data, cmd, &out);
+	free(cmd);
+	while (out.len > 0 && out.buf[out.len - 1] == '\n')
+		out.buf[--out.len] = '\0';
+	if (ret > 0)
+		ret = (ft_sb_reserve(&out, 0) && replace_range(str, *i, end, out.buf));
+	if (ret > 0)
+		*i += out.len - 1;
+	ft_sb_free(&out);
+	return (ret);
+}
@@ -14,7 +14,8 @@ int	expand_variables(char **str, t_data *data, int expand_in_single_quotes);
 Used in expand_variables().
 
 This function extracts the variable name following a '$' character.
-Variable names are delimited by any character that is not alphanumerical.
+Variable names are delimited by any character that is not alphanumerical or
+an underscore.
 
  @param str 	The string from which to extract the variable name.
  @param i 		The position in the string where the '$' character is located.
@@ -37,7 +38,7 @@ static char	*get_var_name(char *str, int i)
 		return (var_name);
 	}
 	var_end = var_start;
-	while (ft_isalnum(*var_end))
+	while (ft_isalnum(*var_end) || *var_end == '_')
 		var_end++;
 	var_len = var_end - var_start;
 	var_name = malloc(var_len + 1);
@@ -59,20 +60,20 @@ Also extracts the last exit status for '$?'.
 			`NULL` if memory allocation for the empty or exit status string
 			failed.
 
-If an exit status string is returned, it is the user's responsibilty to
-free it when done using.
+The empty and exit status strings are allocated and also stored in `*owned`,
+which is `NULL` for the value of an existing variable: it belongs to the
+environment list and must not be freed.
 */
-static char	*get_var_value(const char *var_name, t_data *data)
+static char	*get_var_value(const char *var_name, t_data *data, char **owned)
 {
 	t_env	*current_node;
-	char	*exit_status;
-	char	*empty_str;
 
+	*owned = NULL;
 	current_node = data->envp_temp;
 	if (ft_strcmp(var_name, "?") == 0)
 	{
-		exit_status = ft_itoa(data->exit_status);
-		return (exit_status);
+		*owned = ft_itoa(data->exit_status);
+		return (*owned);
 	}
 	while (current_node)
 	{
@@ -80,10 +81,8 @@ static char	*get_var_value(const char *var_name, t_data *data)
 			return (current_node->value);
 		current_node = current_node->next;
 	}
-	empty_str = ft_strdup("");
-	if (!empty_str)
-		return (NULL);
-	return (empty_str);
+	*owned = ft_strdup("");
+	return (*owned);
 }
 
 /**
@@ -113,27 +112,26 @@ static int	replace_var_with_val(char **str, int i, char *var_name,
 		t_data *data)
 {
 	char	*var_val;
+	char	*owned;
 	char	*str_l;
 	char	*str_r;
 
 	str_l = NULL;
 	str_r = NULL;
-	var_val = get_var_value(var_name, data);
+	var_val = get_var_value(var_name, data, &owned);
 	if (!var_val)
 		return (0);
 	if (!get_str_l(str, i, &str_l) || !get_str_r(str, i, var_name, &str_r))
 	{
-		free_vars(&var_val, &str_l, &str_r);
+		free_vars(&owned, &str_l, &str_r);
 		return (0);
 	}
 	if (!join_str_l(str, str_l, var_val) || !join_str_r(str, str_r))
 	{
-		free_vars(&var_val, &str_l, &str_r);
+		free_vars(&owned, &str_l, &str_r);
 		return (0);
 	}
-	free_vars(&var_val, &str_l, &str_r);
-	if (ft_strcmp(var_name, "?") == 0)
-		free(var_val);
+	free_vars(&owned, &str_l, &str_r);
 	return (1);
 }
 
@@ -142,7 +140,10 @@ Processes a variable in the string and replaces it with its corresponding value
 from the minishell environment list.
 
 This function identifies if the current position in the string (`*str` at `*i`)
-starts a valid variable (indicated by a `$` character).
+starts a valid variable (indicated by a `$` character), an arithmetic
+expansion (`$((`, see parser_arith.c), a command substitution (`$(` or a
+backtick, see parser_subst.c) or a parameter expansion (`${`, see
+parser_param.c).
 If the variable is valid and either expansion within single quotes is allowed
 or the string is not within single quotes, the function replaces the
 variable name with its value from the environment list.
@@ -160,15 +161,24 @@ variable name with its value from the environment list.
 
  @return	`1` if the variable was successfully processed and replaced;
  			`0` if there was an error during variable processing or
-			memory if allocation failed.
+			memory if allocation failed;
+			`-1` if an arithmetic or parameter expansion was invalid or a
+			command substitution failed (an error message was printed).
  */
 static int	process_variable(char **str, int *i, t_data *data,
 	int expand_in_single_quotes)
 {
 	char	*var_name;
 
-	if (is_variable(*str, *i) && (expand_in_single_quotes
-			|| !data->quote.in_single))
+	if (!expand_in_single_quotes && data->quote.in_single)
+		return (1);
+	if (arith_end(*str, *i))
+		return (expand_arithmetic(str, i, data));
+	if (subst_end(*str, *i))
+		return (expand_command(str, i, data));
+	if (param_end(*str, *i))
+		return (expand_parameter(str, i, data));
+	if (is_variable(*str, *i))
 	{
 		var_name = get_var_name(*str, *i);
 		if (!var_name)
@@ -185,8 +195,9 @@ static int	process_variable(char **str, int *i, t_data *data,
 }
 
 /**
-Expands all environment variables (including nestes ones) in the given string
-with their corresponding values from the environment list.
+Expands all environment variables (including nestes ones), arithmetic and
+parameter expansions and command substitutions in the given string with their corresponding values from the
+environment list.
 
 This function traverses the input string, identifies variables starting with
 a '$' character, and replaces each variable with its corresponding value from the
@@ -201,10 +212,13 @@ environment list.
  @return	`1` if all variables were successfully expanded.
 			`0` if an error occurred during memory allocation or no string was
 			passed.
+			`-1` if an arithmetic or parameter expansion was invalid or a
+			command substitution failed (an error message was printed).
 */
 int	expand_variables(char **str, t_data *data, int expand_in_single_quotes)
 {
 	int		i;
+	int		ret;
 
 	i = 0;
 	if (!str || !*str)
@@ -217,8 +231,9 @@ int	expand_variables(char **str, t_data *data, int expand_in_single_quotes)
 			i++;
 			continue ;
 		}
-		if (!process_variable(str, &i, data, expand_in_single_quotes))
-			return (0);
+		ret = process_variable(str, &i, data, expand_in_single_quotes);
+		if (ret <= 0)
+			return (ret);
 		i++;
 	}
 	return (1);
@@ -109,8 +109,9 @@ Frees dynamically allocated memory for variable values and substrings.
 Ensures that only allocated memory is freed and avoids freeing memory
 that was not dynamically allocated.
 
- @param var_val 	Pointer to the dynamically allocated variable value which
- 					may need freeing.
+ @param var_val 	Pointer to the variable value if it was allocated (see
+ 					get_var_value()), `NULL` if it belongs to the
+ 					environment list.
  @param str_l 		Pointer to the dynamically allocated substring which may
  					need freeing.
  @param str_r 		Pointer to the dynamically allocated substring which may
@@ -118,7 +119,7 @@ that was not dynamically allocated.
 */
 void	free_vars(char **var_val, char **str_l, char **str_r)
 {
-	if (ft_strcmp(*var_val, "") == 0)
+	if (*var_val)
 		free(*var_val);
 	if (*str_l)
 		free(*str_l);
@@ -2,7 +2,7 @@
 
 // Checking if the input is a builtin command, checks if the arguments are
 // valid and executes the builtin.
-int	builtin(t_data *data, t_exec *exec)
+static int	run_builtin(t_data *data, t_exec *exec)
 {
 	if (!ft_strcmp(exec->cmd, "pwd"))
 		return (pwd(exec));
@@ -23,5 +23,24 @@ int	builtin(t_data *data, t_exec *exec)
 		return (export(data, exec));
 	else if (!ft_strcmp(exec->cmd, "echo"))
 		return (minishell_echo(exec));
+	else if (!ft_strcmp(exec->cmd, "times"))
+		return (minishell_times(exec));
+	else if (!ft_strcmp(exec->cmd, "memstat"))
+		return (minishell_memstat(exec));
 	return (0);
 }
+
+// Executes the builtin and writes its buffered output at once (see
+// builtin_output.c). A failed write makes the builtin fail, like in bash.
+int	builtin(t_data *data, t_exec *exec)
+{
+	int	exit_code;
+
+	if (!ft_strcmp(exec->cmd, "let"))
+		exit_code = minishell_let(data, exec);
+	else
+		exit_code = run_builtin(data, exec);
+	if (out_flush(exec) && exit_code == 0)
+		exit_code = 1;
+	return (exit_code);
+}
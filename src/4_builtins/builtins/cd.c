@@ -95,17 +95,11 @@ static int	cd_to_home_user(t_cd **cd, t_env *envp_temp)
 // Throws an error if the defined subdirectory doesn't exist.
 static int	cd_one_down(t_cd **cd, char *cwd, t_exec *exec)
 {
-	char	*input;
-
 	if (chdir(exec->flags[1]) == 0)
 		return (0);
 	if (!cwd)
 		return (1);
-	input = ft_strjoin("/", exec->flags[1]);
-	if (!input)
-		print_error_cd(1, cd);
-	(*cd)->subdirectory = ft_strjoin(cwd, input);
-	free(input);
+	(*cd)->subdirectory = ft_strjoin_n(3, cwd, "/", exec->flags[1]);
 	if (!(*cd)->subdirectory)
 		print_error_cd(1, cd);
 	if (chdir((*cd)->subdirectory) == -1)
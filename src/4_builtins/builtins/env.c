@@ -8,7 +8,10 @@ int	env(t_exec *exec, t_env *envp_temp)
 		return (env_error_messages(exec->flags[1], 0));
 	while (envp_temp)
 	{
-		printf("%s=%s\n", envp_temp->e_var, envp_temp->value);
+		out_add(exec, envp_temp->e_var);
+		out_add(exec, "=");
+		out_add(exec, envp_temp->value);
+		out_add(exec, "\n");
 		envp_temp = envp_temp->next;
 	}
 	return (0);
@@ -3,15 +3,19 @@
 // Prints a list of the current exported environmental variables, mimicking the
 // behavior of the "export"-command in bash without arguments/options.
 // It is sorted in alphabetical order.
-int	print_export(t_env *export_list)
+int	print_export(t_exec *exec, t_env *export_list)
 {
 	while (export_list)
 	{
+		out_add(exec, "declare -x ");
+		out_add(exec, export_list->e_var);
 		if (export_list->value)
-			printf("declare -x %s=\"%s\"\n", export_list->e_var, \
-			export_list->value);
-		else
-			printf("declare -x %s\n", export_list->e_var);
+		{
+			out_add(exec, "=\"");
+			out_add(exec, export_list->value);
+			out_add(exec, "\"");
+		}
+		out_add(exec, "\n");
 		export_list = export_list->next;
 	}
 	return (0);
@@ -29,7 +33,7 @@ int	export(t_data *data, t_exec *exec)
 
 	i = 1;
 	if (!exec->flags[1])
-		return (print_export(data->export_list));
+		return (print_export(exec, data->export_list));
 	if (ft_strchr(exec->flags[1], '-') || !ft_is_alphanumerical(exec->flags))
 		return (export_err_invalid_option(exec->flags[1], 0));
 	while (exec->flags[i])
@@ -13,7 +13,10 @@ int	pwd(t_exec *exec)
 			return (pwd_invalid_option(exec->flags[1], 0));
 	}
 	if (getcwd(cwd, sizeof(cwd)))
-		printf("%s\n", cwd);
+	{
+		out_add(exec, cwd);
+		out_add(exec, "\n");
+	}
 	else
 		print_err_msg_prefix("pwd");
 	return (0);
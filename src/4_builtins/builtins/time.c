@@ -0,0 +1,78 @@
+#include "minishell.h"
+
+/*Starts timing a command line prefixed with the reserved word 'time': Stores
+the current time and the shell's own resource usage, and resets the usage of
+the children, which finish_children() adds up for every stage of the
+pipeline (via wait4()).*/
+void	start_timing(t_data *data)
+{
+	data->timing.active = true;
+	clock_gettime(CLOCK_MONOTONIC, &data->timing.start);
+	getrusage(RUSAGE_SELF, &data->timing.self);
+	ft_bzero(&data->timing.children, sizeof(struct rusage));
+}
+
+/*Adds the resource usage of a finished child to the usage of the current
+pipeline: CPU times are summed up, the maximum resident set size is the
+largest one of all stages.*/
+void	add_child_usage(t_data *data, struct rusage *usage)
+{
+	struct rusage	*total;
+
+	total = &data->timing.children;
+	total->ru_utime.tv_sec += usage->ru_utime.tv_sec;
+	total->ru_utime.tv_usec += usage->ru_utime.tv_usec;
+	total->ru_stime.tv_sec += usage->ru_stime.tv_sec;
+	total->ru_stime.tv_usec += usage->ru_stime.tv_usec;
+	if (usage->ru_maxrss > total->ru_maxrss)
+		total->ru_maxrss = usage->ru_maxrss;
+}
+
+/*Returns the CPU time between two measurements of the shell's usage plus
+the CPU time of the pipeline's children, in microseconds.*/
+static long	cpu_time(struct timeval end, struct timeval start,
+	struct timeval children)
+{
+	return ((end.tv_sec - start.tv_sec + children.tv_sec) * 1000000L
+		+ end.tv_usec - start.tv_usec + children.tv_usec);
+}
+
+/*Builds the report of a timed command line: the elapsed real time, the user
+and system CPU time of the shell and all stages of the pipeline, and the
+largest maximum resident set size of any stage.*/
+static int	build_report(t_strbuf *sb, t_timing *t, struct rusage *self,
+	struct timespec *now)
+{
+	long	real;
+
+	real = (now->tv_sec - t->start.tv_sec) * 1000000L
+		+ (now->tv_nsec - t->start.tv_nsec) / 1000;
+	return (ft_sb_adds(sb, "\nreal\t") && add_duration(sb, real)
+		&& ft_sb_adds(sb, "\nuser\t") && add_duration(sb, cpu_time(
+				self->ru_utime, t->self.ru_utime, t->children.ru_utime))
+		&& ft_sb_adds(sb, "\nsys\t") && add_duration(sb, cpu_time(
+				self->ru_stime, t->self.ru_stime, t->children.ru_stime))
+		&& ft_sb_adds(sb, "\nmaxrss\t")
+		&& ft_sb_addnbr(sb, t->children.ru_maxrss) && ft_sb_adds(sb, "k\n"));
+}
+
+/*Reports the timing of a command line prefixed with 'time' on stderr (like
+bash), once the whole pipeline has finished.*/
+void	report_timing(t_data *data)
+{
+	t_strbuf		sb;
+	struct rusage	self;
+	struct timespec	now;
+
+	if (!data->timing.active)
+		return ;
+	data->timing.active = false;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	getrusage(RUSAGE_SELF, &self);
+	ft_sb_init(&sb);
+	if (build_report(&sb, &data->timing, &self, &now))
+		write(STDERR_FILENO, sb.buf, sb.len);
+	else
+		print_err_msg_prefix("time");
+	ft_sb_free(&sb);
+}
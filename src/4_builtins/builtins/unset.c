@@ -8,7 +8,7 @@ static void	unset_remove_variable(t_env **current, t_env **envp_temp, char *arg)
 {
 	while (*current)
 	{
-		if (ft_strncmp(arg, (*current)->e_var, ft_strlen(arg)) == 0)
+		if (ft_strcmp(arg, (*current)->e_var) == 0)
 		{
 			if ((*current)->next)
 				(*current)->next->previous = (*current)->previous;
@@ -16,9 +16,9 @@ static void	unset_remove_variable(t_env **current, t_env **envp_temp, char *arg)
 				(*current)->previous->next = (*current)->next;
 			else
 				*envp_temp = (*current)->next;
-			free((*current)->value);
-			free((*current)->e_var);
-			free(*current);
+			env_free((*current)->value);
+			env_free((*current)->e_var);
+			env_free(*current);
 			break ;
 		}
 		*current = (*current)->next;
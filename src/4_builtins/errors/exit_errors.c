@@ -14,46 +14,44 @@ static void	mem_alloc_fail_exit(t_data *data, char *tmp_error_msg)
 }
 
 /*Prints an error message when the exit command is used, if there is more
-than one argument*/
+than one argument. The words of the input are only counted, not copied.*/
 void	exit_check_argc(t_data *data)
 {
-	char	**arguments;
+	const char	*cursor;
+	const char	*word;
+	size_t		len;
+	int			count;
 
-	arguments = ft_split(data->input, ' ');
-	if (!arguments)
-		mem_alloc_fail_exit(data, NULL);
-	if (count_array_length(arguments) > 2)
+	cursor = data->input;
+	count = 0;
+	while (ft_split_next(&cursor, ' ', &word, &len))
+		count++;
+	if (count > 2)
 	{
 		print_err_msg_custom("exit: too many arguments", 1, 1);
-		ft_freearray(arguments);
 		free_data(data, 1);
 		exit(EPERM);
 	}
-	ft_freearray(arguments);
 }
 
 /*Prints an error message when the exit command is used, if the argument is
 not numerical*/
 void	print_error_exit(t_data *data, t_exec *exec)
 {
-	char	*tmp_error_msg;
 	char	*full_error_msg;
 	char	*exit_argument;
 
-	tmp_error_msg = NULL;
 	full_error_msg = NULL;
 	exit_argument = NULL;
-	printf("exit\n");
+	if (data->interactive)
+		printf("exit\n");
 	exit_argument = ft_strchr(data->input, ' ');
 	exit_argument++;
-	tmp_error_msg = ft_strjoin("exit: ", exit_argument);
-	if (!tmp_error_msg)
-		mem_alloc_fail_exit(data, NULL);
-	full_error_msg = ft_strjoin(tmp_error_msg, ": numeric argument required\n");
+	full_error_msg = ft_strjoin_n(3, "exit: ", exit_argument,
+			": numeric argument required\n");
 	if (!full_error_msg)
-		mem_alloc_fail_exit(data, tmp_error_msg);
+		mem_alloc_fail_exit(data, NULL);
 	print_err_msg_custom(full_error_msg, 1, 0);
-	free(tmp_error_msg);
 	free(full_error_msg);
 	free_exec(exec);
 	free_data(data, 1);
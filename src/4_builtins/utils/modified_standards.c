@@ -62,10 +62,10 @@ int	is_letter(char c)
 }
 
 /*Checks if all the characters in an array of strings is an alphabetical
-character or a number. Checks each string separately, up until an '='-sign
-is found.
+character, a number or an underscore. Checks each string separately, up until
+an '='-sign is found.
 Returns 1 if all the data is alphanumerical.
-Return 0 if a non-number or non-alphabetical character is found.*/
+Return 0 if any other character is found.*/
 int	ft_is_alphanumerical(char **flags)
 {
 	int	i;
@@ -78,7 +78,7 @@ int	ft_is_alphanumerical(char **flags)
 		while (flags[str][i] && flags[str][i] != '=')
 		{
 			if ((flags[str][i] < '0' || flags[str][i] > '9')
-				&& !is_letter(flags[str][i]))
+				&& !is_letter(flags[str][i]) && flags[str][i] != '_')
 				return (0);
 			i++;
 		}
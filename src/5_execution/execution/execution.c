@@ -7,17 +7,23 @@ takes over to execute the command. If anything fails, it prints out an error
 message and returns the right exit code.*/
 void	execution(t_data *data, t_exec *exec, int position)
 {
-	int	builtin_exit_code;
+	int				builtin_exit_code;
+	unsigned long	start;
 
+	start = trace_now(data);
 	builtin_exit_code = 0;
 	prep_execution(data, exec, position);
 	if (is_builtin(exec))
 	{
 		builtin_exit_code = builtin(data, exec);
+		trace_add(data, PH_EXEC, start);
 		free_exec(exec);
 		free_data(data, 1);
 		exit(builtin_exit_code);
 	}
+	pass_procsubst_fds(data, exec);
+	check_fd_leaks(data, exec);
+	trace_add(data, PH_EXEC, start);
 	execve(exec->current_path, exec->flags, exec->envp_temp_arr);
 	exec_errors(data, exec, 4);
 	exit(errno);
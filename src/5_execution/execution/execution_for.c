@@ -0,0 +1,46 @@
+#include "minishell.h"
+
+/*Expands the words of a 'for' loop once, when the loop starts: A copy of
+them goes through expansion and quote removal like the tokens of a command.
+Returns the expanded words, NULL if there are none or on failure.*/
+static t_list	*expand_words(t_data *data, t_list *words)
+{
+	int	ok;
+
+	if (!words)
+		return (NULL);
+	data->tok.tok_lst = copy_tokens(words, NULL);
+	if (!data->tok.tok_lst)
+	{
+		print_err_msg(ERR_MALLOC);
+		return (NULL);
+	}
+	ok = parse_tokens(data);
+	words = data->tok.tok_lst;
+	data->tok.tok_lst = NULL;
+	if (!ok)
+		ft_lstclear(&words, del_token);
+	return (words);
+}
+
+/*Executes a 'for' loop: the body once per word, with the loop variable set
+to it. The exit status is the one of the last execution of the body, 0 if
+there were no words. CTRL + C stops the loop.*/
+void	run_for(t_data *data, t_node *node)
+{
+	t_list	*words;
+	t_list	*current;
+
+	words = expand_words(data, node->tokens);
+	current = words;
+	data->exit_status = 0;
+	while (current && !g_signal)
+	{
+		if (!set_env_var(data, node->name,
+				((t_token *)current->content)->lexeme))
+			break ;
+		run_list(data, node->body);
+		current = current->next;
+	}
+	ft_lstclear(&words, del_token);
+}
@@ -0,0 +1,111 @@
+#include "minishell.h"
+
+/*Checks if expanding a word may change the shell: an arithmetic expansion
+(which may assign, '$((x=5))'), a parameter expansion with a '=' (which may
+assign a default, '${x:=5}') or a process substitution (which starts a
+command).*/
+static int	has_side_effects(const char *word)
+{
+	char	*param;
+	size_t	len;
+
+	len = ft_strlen(word);
+	param = ft_strnstr(word, "${", len);
+	return (ft_strnstr(word, "$((", len) || ft_strnstr(word, "<(", len)
+		|| ft_strnstr(word, ">(", len) || (param && ft_strchr(param, '=')));
+}
+
+/*Checks if a command substitution only runs a builtin which has no effect on
+the shell itself and can therefore run without a subshell: echo, pwd, env or
+export without arguments, with no pipes or redirections and no arguments
+whose expansion has an effect on the shell (see has_side_effects()). The
+name of the builtin has to be written literally (it is checked before
+expansion).*/
+static int	is_capturable(t_list *tokens)
+{
+	t_list	*current;
+	char	*cmd;
+
+	current = tokens;
+	while (current)
+	{
+		if (((t_token *)current->content)->type != OTHER
+			|| has_side_effects(((t_token *)current->content)->lexeme))
+			return (0);
+		current = current->next;
+	}
+	cmd = ((t_token *)tokens->content)->lexeme;
+	return (!ft_strcmp(cmd, "echo") || !ft_strcmp(cmd, "pwd")
+		|| !ft_strcmp(cmd, "env")
+		|| (!ft_strcmp(cmd, "export") && !tokens->next));
+}
+
+/*Runs the command of a command substitution. A builtin without side effects
+(see is_capturable()) runs in the shell itself, without forking: its output
+goes straight into 'out' instead of being written (see out_flush()), and
+expansions within its arguments are done by the shell as well. Anything else
+runs in a subshell (see capture_child()).
+Returns 1 on success, -1 on failure (an error message was printed).*/
+static int	capture_output(t_data *data, void *out)
+{
+	t_exec	*exec;
+
+	if (!is_capturable(data->tok.tok_lst))
+		return (capture_child(data, out));
+	if (!parse_tokens(data))
+		return (-1);
+	exec = malloc(sizeof(t_exec));
+	if (!exec)
+		exec_errors(data, exec, 1);
+	set_exec_members_to_null(exec);
+	get_flags_and_command(data, exec, 0);
+	exec->capture = out;
+	data->exit_status = builtin(data, exec);
+	free_exec(exec);
+	return (1);
+}
+
+/*Tokenizes a command line other than the one being expanded, e.g. the one of
+a command substitution, and calls 'run' with its tokens in data->tok. The
+state of the command line being expanded is set aside meanwhile and restored
+after.
+Returns the return value of 'run', -1 if the command line could not be
+tokenized (an error message was printed).*/
+int	with_command_line(t_data *data, char *cmd,
+		int (*run)(t_data *, void *), void *arg)
+{
+	t_tok	tok;
+	t_quote	quote;
+	char	*input;
+	int		pipe_nr;
+	int		ret;
+
+	tok = data->tok;
+	quote = data->quote;
+	input = data->input;
+	pipe_nr = data->pipe_nr;
+	ft_bzero(&data->tok, sizeof(t_tok));
+	ft_bzero(&data->quote, sizeof(t_quote));
+	data->input = cmd;
+	data->pipe_nr = 0;
+	ret = -1;
+	if (get_cached_tokens(data))
+		ret = run(data, arg);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok = tok;
+	data->quote = quote;
+	data->input = input;
+	data->pipe_nr = pipe_nr;
+	return (ret);
+}
+
+/*Runs the command line of a command substitution (which may contain pipelines
+and control flow) and appends its output to 'out' (see capture_output()).
+Returns 1 on success, -1 if the command could not be run (an error message
+was printed).*/
+int	command_subst(t_data *data, char *cmd, t_strbuf *out)
+{
+	if (is_only_whitespace(cmd))
+		return (1);
+	return (with_command_line(data, cmd, capture_output, out));
+}
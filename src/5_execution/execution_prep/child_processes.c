@@ -1,7 +1,7 @@
 #include "minishell.h"
 
 /*Error handling in the case of forking failed or one child process fails,
-returning -1 from waitpid. Prints out an error message, frees all allocated
+returning -1 from wait4. Prints out an error message, frees all allocated
 memory and exits the main process.*/
 static void	error_child_processes(t_data *data, t_exec *exec)
 {
@@ -25,43 +25,69 @@ static void	set_exit_code(t_data *data, int stat_loc)
 	}
 }
 
-/*Closes the pipe in the parent, waits for all children to finish, and sets
-the correct exit status.*/
-static void	finish_children(pid_t pid, int stat_loc, t_data *data, t_exec *exec)
+/*Closes the pipes and here-strings in the parent, and waits for all children
+to finish - not only the last one, so no zombie processes are left behind.
+The exit status is the one of the last command of the pipeline. The resource
+usage of every stage (from wait4()) is added up for the reserved word 'time'.*/
+static void	finish_children(t_data *data, t_exec *exec)
 {
-	close_pipe_in_parent(data, exec);
-	if (waitpid(pid, &stat_loc, 0) == -1)
-		error_child_processes(data, exec);
-	set_exit_code(data, stat_loc);
+	int				i;
+	int				stat_loc;
+	struct rusage	usage;
+
+	close_pipes(data, exec);
+	close_herestrings(data);
+	i = 0;
+	while (i < exec->curr_child)
+	{
+		if (wait4(exec->child->nbr[i], &stat_loc, 0, &usage) == -1)
+			error_child_processes(data, exec);
+		add_child_usage(data, &usage);
+		if (i == exec->curr_child - 1)
+			set_exit_code(data, stat_loc);
+		i++;
+	}
+	trace_mark(data, PH_WAIT, PH_OTHER);
+}
+
+/*Prepares everything the children share before the first fork: All pipes of
+the pipeline are created and stored in the pipeline's fd table, each child
+picks its ends by index. Here-strings are written into memory files. Anything
+still buffered in the parent's stdout gets flushed, otherwise every child
+exiting through exit() would print it again.*/
+static void	prepare_children(t_data *data, t_exec *exec)
+{
+	create_pipes(data, exec);
+	open_herestrings(data, exec);
+	fflush(stdout);
+	trace_mark(data, PH_PLAN, PH_FORK);
 }
 
-/*Creates the necessary child processes, one per command. Creates a pipe for 
-each process, and always closing the previous pipe (if it exists). For each 
-round it saves the current pipe, so the data gets stored for the next round.*/
+/*Creates the necessary child processes, one per command, after preparing
+the pipes and here-strings. The parent closes all of them once all children
+are created.*/
 void	create_child_processes(t_data *data, t_exec *exec)
 {
 	pid_t	pid;
-	int		stat_loc;
 	t_list	*current;
 	t_token	*token;
 
 	current = (t_list *)data->tok.tok_lst;
 	token = (t_token *)current->content;
-	stat_loc = 0;
+	prepare_children(data, exec);
 	while (exec->curr_child < data->pipe_nr + 1)
 	{
-		create_pipe(data, exec);
 		pid = fork();
 		if (pid == -1)
 			error_child_processes(data, exec);
 		if (!pid)
 			execution(data, exec, token->position);
-		handle_pipe_in_parent(data, exec);
 		exec->child->nbr[exec->curr_child++] = pid;
 		while (token->type != PIPE && current)
 			move_current_and_update_token(&current, &token);
 		if (current && current->next)
 			token = (t_token *)current->next->content;
 	}
-	finish_children(pid, stat_loc, data, exec);
+	trace_mark(data, PH_FORK, PH_WAIT);
+	finish_children(data, exec);
 }
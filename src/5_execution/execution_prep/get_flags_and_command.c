@@ -33,8 +33,7 @@ void	set_flags_and_cmd(t_data *data, t_exec *exec, int position, int count)
 		exec_errors(data, exec, 1);
 	while (i < count)
 	{
-		if (token->type != REDIR_IN && token->type != REDIR_OUT
-			&& token->type != APPEND_OUT)
+		if (!is_redir_token(token->type))
 			i += set_flag(data, &exec, token, i);
 		else
 			move_current_and_update_token(&current, &token);
@@ -60,8 +59,7 @@ void	get_flags_and_command(t_data *data, t_exec *exec, int position)
 		move_current_and_update_token(&current, &token);
 	while (current && token->type != PIPE)
 	{
-		if (token->type == REDIR_IN || token->type == REDIR_OUT
-			|| token->type == APPEND_OUT)
+		if (is_redir_token(token->type))
 			move_current_and_update_token(&current, &token);
 		else
 		{
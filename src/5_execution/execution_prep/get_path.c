@@ -16,74 +16,59 @@ int	cmd_is_path(t_data *data, t_exec *exec)
 	return (0);
 }
 
-/*Uses ft_strjoin to add a "/"-sign at the end of each path, so it can easily
-be executed later on.*/
-static void	add_slash_at_end_of_all_paths(t_data *data, t_exec *exec, char *tmp)
-{
-	int	i;
-
-	i = 0;
-	while (exec->all_paths[i])
-	{
-		tmp = ft_strjoin(exec->all_paths[i], "/");
-		if (!tmp)
-			exec_errors(data, exec, 1);
-		free(exec->all_paths[i]);
-		exec->all_paths[i] = ft_strdup(tmp);
-		free(tmp);
-		if (!exec->all_paths[i])
-			exec_errors(data, exec, 1);
-		i++;
-	}
-}
-
-/*Iterates through the envp_temp_arr to look for "PATH". If found, it stores
-the paths in exec->all_paths.*/
+/*Iterates through the envp_temp_arr to look for "PATH". If found, it splits
+the paths into exec->all_paths - with ft_split_flat, so all of them are stored
+in a single allocation (freed with a single free()).*/
 void	get_all_paths(t_data *data, t_exec *exec)
 {
-	char	*tmp;
-	int		i;
+	int	i;
 
 	i = 0;
-	tmp = NULL;
 	while (exec->envp_temp_arr[i])
 	{
-		if (ft_strncmp(exec->envp_temp_arr[i], "PATH", 4) == 0)
+		if (ft_strncmp(exec->envp_temp_arr[i], "PATH=", 5) == 0)
 		{
-			tmp = ft_substr(exec->envp_temp_arr[i], 5, \
-			ft_strlen(exec->envp_temp_arr[i]));
-			if (!tmp)
-				exec_errors(data, exec, 1);
-			exec->all_paths = ft_split(tmp, ':');
+			exec->all_paths = ft_split_flat(exec->envp_temp_arr[i] + 5, ':');
 			if (!exec->all_paths)
 				exec_errors(data, exec, 1);
-			add_slash_at_end_of_all_paths(data, exec, tmp);
-			free(tmp);
 			return ;
 		}
 		i++;
 	}
+	exec->all_paths = NULL;
 	exec_errors(data, exec, 2);
 }
 
 /*Iterates through all the paths in the environmental variable $PATH,
 and checks if that path + the command would be executable. If that's not
 the case after iterating through all the paths, it throws an error message
-and exits the process.*/
+and exits the process.
+All candidates "path/cmd" are built in the same string buffer, which is only
+reset (not freed) between them, so this takes a single allocation in most
+cases.*/
 void	get_correct_path(t_data *data, t_exec *exec)
 {
-	int	i;
+	t_strbuf	sb;
+	int			i;
 
+	ft_sb_init(&sb);
 	i = 0;
 	while (exec->all_paths[i])
 	{
-		if (exec->current_path)
-			free(exec->current_path);
-		exec->current_path = ft_strjoin(exec->all_paths[i], exec->cmd);
-		if (access(exec->current_path, X_OK) == 0)
-			break ;
+		ft_sb_reset(&sb);
+		if (!ft_sb_adds(&sb, exec->all_paths[i]) || !ft_sb_addc(&sb, '/')
+			|| !ft_sb_adds(&sb, exec->cmd))
+		{
+			ft_sb_free(&sb);
+			exec_errors(data, exec, 1);
+		}
+		if (access(sb.buf, X_OK) == 0)
+		{
+			exec->current_path = ft_sb_steal(&sb);
+			return ;
+		}
 		i++;
 	}
-	if (access(exec->current_path, X_OK) != 0)
-		error_incorrect_path(data, exec);
+	ft_sb_free(&sb);
+	error_incorrect_path(data, exec);
 }
@@ -0,0 +1,86 @@
+#include "minishell.h"
+
+/*Writes the whole here-string into fd, followed by a newline (just like in
+bash, a here-string always ends with one).
+Returns 1 on success, 0 if writing failed.*/
+static int	write_herestring(int fd, const char *word)
+{
+	size_t	len;
+	ssize_t	written;
+
+	len = ft_strlen(word);
+	while (len > 0)
+	{
+		written = write(fd, word, len);
+		if (written == -1)
+			return (0);
+		word += written;
+		len -= written;
+	}
+	return (write(fd, "\n", 1) == 1);
+}
+
+/*Writes the (already expanded) operand of a here-string into an anonymous
+memory file and rewinds it. The operand is then replaced by the number of
+that fd, so the child only has to duplicate it onto its input, like '<&N'.
+This involves no file on disk and no extra process, and as the parent writes
+the whole string before forking, its size is not limited by a pipe's
+capacity.*/
+static void	open_herestring(t_data *data, t_exec *exec, t_token *operand)
+{
+	int		fd;
+	char	*fd_str;
+
+	fd = memfd_create("herestring", MFD_CLOEXEC);
+	if (fd == -1 || !write_herestring(fd, operand->lexeme)
+		|| lseek(fd, 0, SEEK_SET) == -1)
+	{
+		ft_putstr_fd(ERR_PREFIX, 2);
+		perror("here-string");
+		if (fd != -1)
+			close(fd);
+		exec_errors(data, exec, 0);
+	}
+	fd_str = ft_itoa(fd);
+	if (!fd_str)
+	{
+		close(fd);
+		exec_errors(data, exec, 1);
+	}
+	free(operand->lexeme);
+	operand->lexeme = fd_str;
+}
+
+/*Goes through all tokens of the pipeline and prepares a memory file for each
+here-string ('<<<'), before any child process is created.*/
+void	open_herestrings(t_data *data, t_exec *exec)
+{
+	t_list	*current;
+	t_token	*token;
+
+	current = (t_list *)data->tok.tok_lst;
+	while (current)
+	{
+		token = (t_token *)current->content;
+		if (token->type == HERESTRING)
+			open_herestring(data, exec, (t_token *)current->next->content);
+		current = current->next;
+	}
+}
+
+/*Closes the memory files of all here-strings in the parent, once all child
+processes are created.*/
+void	close_herestrings(t_data *data)
+{
+	t_list	*current;
+	t_token	*token;
+
+	current = (t_list *)data->tok.tok_lst;
+	while (current)
+	{
+		token = (t_token *)current->content;
+		if (token->type == HERESTRING)
+			close(ft_atoi(((t_token *)current->next->content)->lexeme));
+		current = current->next;
+	}
+}
@@ -1,33 +1,93 @@
 #include "minishell.h"
 
-void	create_pipe(t_data *data, t_exec *exec)
+/*Parses the value of the PIPE_BUF_VAR environment variable, e.g. "1M",
+"256K" or "65536". A trailing 'K' or 'M' multiplies the number by 1024 or
+1024 * 1024.
+Returns the requested size in bytes, or 0 if the value is not a valid size
+(in which case the kernel's default pipe size is kept).*/
+static int	parse_pipe_size(const char *value)
 {
-	if (exec->curr_child < data->pipe_nr)
-	{
-		if (pipe(exec->pipe_fd) == -1)
-			exec_errors(data, exec, 3);
-	}
+	long	size;
+
+	size = 0;
+	if (!value || !ft_isdigit(*value))
+		return (0);
+	while (ft_isdigit(*value) && size <= INT_MAX)
+		size = size * 10 + (*value++ - '0');
+	if (*value == 'K' || *value == 'k')
+		size *= 1024;
+	else if (*value == 'M' || *value == 'm')
+		size *= 1024 * 1024;
+	else if (*value != '\0')
+		return (0);
+	if (*value && *(value + 1) != '\0')
+		return (0);
+	if (size > INT_MAX)
+		return (0);
+	return ((int)size);
 }
 
-void	handle_pipe_in_parent(t_data *data, t_exec *exec)
+/*Looks up the pipe size requested via the PIPE_BUF_VAR environment variable
+(e.g. "MINISHELL_PIPEBUF=1M ./minishell"), so it only has to be parsed once per
+pipeline and not once per pipe.*/
+static int	get_pipe_size(t_data *data)
 {
-	if (exec->curr_child > 0)
-	{
-		close(exec->prev_pipe_fd[0]);
-		close(exec->prev_pipe_fd[1]);
-	}
-	if (exec->curr_child < data->pipe_nr)
+	return (parse_pipe_size(get_env_value(data->envp_temp, PIPE_BUF_VAR)));
+}
+
+/*Creates all pipes of the pipeline at once and stores their ends in the
+pipeline's fd table (exec->pipes): The n-th pipe (connecting the n-th and the
+n+1-th command) is stored at index 2n (read end) and 2n+1 (write end), so
+every child finds its ends by index, without passing pipes from one round to
+the next.
+The pipes are created with O_CLOEXEC, so they never leak into executed
+programs (the ends that are actually used are dup2'ed onto STDIN/STDOUT,
+which clears the flag).
+If a pipe size was requested, the pipe's capacity is raised accordingly;
+this is only an optimization, so a failure (e.g. the size exceeds
+/proc/sys/fs/pipe-max-size) keeps the default capacity.*/
+void	create_pipes(t_data *data, t_exec *exec)
+{
+	int	pipe_size;
+	int	i;
+
+	if (data->pipe_nr == 0)
+		return ;
+	exec->pipes = malloc(sizeof(int) * data->pipe_nr * 2);
+	if (!exec->pipes)
+		exec_errors(data, exec, 1);
+	i = 0;
+	while (i < data->pipe_nr * 2)
+		exec->pipes[i++] = -1;
+	pipe_size = get_pipe_size(data);
+	i = 0;
+	while (i < data->pipe_nr)
 	{
-		exec->prev_pipe_fd[0] = exec->pipe_fd[0];
-		exec->prev_pipe_fd[1] = exec->pipe_fd[1];
+		if (pipe2(&exec->pipes[i * 2], O_CLOEXEC) == -1)
+		{
+			close_pipes(data, exec);
+			exec_errors(data, exec, 3);
+		}
+		if (pipe_size > 0)
+			fcntl(exec->pipes[i * 2 + 1], F_SETPIPE_SZ, pipe_size);
+		i++;
 	}
 }
 
-void	close_pipe_in_parent(t_data *data, t_exec *exec)
+/*Closes all pipe ends of the pipeline's fd table in one pass. Used by each
+child (after its ends were dup2'ed onto STDIN/STDOUT) and by the parent (after
+all children were created), so no write end stays open and delays EOF.*/
+void	close_pipes(t_data *data, t_exec *exec)
 {
-	if (data->pipe_nr > 0)
+	int	i;
+
+	i = 0;
+	if (!exec->pipes)
+		return ;
+	while (i < data->pipe_nr * 2)
 	{
-		close(exec->pipe_fd[0]);
-		close(exec->pipe_fd[1]);
+		if (exec->pipes[i] != -1)
+			close(exec->pipes[i]);
+		exec->pipes[i++] = -1;
 	}
 }
@@ -1,59 +1,45 @@
 #include "minishell.h"
 
-/*In the case of several redirections, and a mix of append and redir_out,
-this function ensures that not both "append" and "redir_out" are set to true,
-but only the last redirection type.*/
-static void	reset_redir_or_append_out(t_exec *exec, bool redir_type)
+/*Returns the fd a redirection applies to: either the number the operator is
+prefixed with (e.g. '2>'), or the default fd of the operator - STDIN for
+operators starting with '<', STDOUT for all others ('&>' additionally
+redirects STDERR, see apply_redirection()).*/
+static int	get_redir_fd(t_token *token)
 {
-	if (redir_type == 0)
-	{
-		exec->redir_out = 1;
-		if (exec->append_out == 1)
-			exec->append_out = 0;
-	}
-	if (redir_type == 1)
-	{
-		exec->append_out = 1;
-		if (exec->redir_out == 1)
-			exec->redir_out = 0;
-	}
+	if (ft_isdigit(token->lexeme[0]))
+		return (ft_atoi(token->lexeme));
+	if (token->lexeme[0] == '<')
+		return (STDIN_FILENO);
+	return (STDOUT_FILENO);
 }
 
-/*If a redirection symbol '>' meaning the output should be redirected, 
-it saves the information in the bool exec->redir_out and stores the filename 
-of the new output source in exec->outfile.*/
-static t_list	*redirect_out(t_data *data, t_exec *exec, t_list *current, \
-t_token *token)
+/*Appends one redirection entry to exec->redirs. The target is not copied, it
+points to the lexeme of the operand token, which outlives the exec struct.*/
+static void	add_redir(t_data *data, t_exec *exec, t_token *op, t_token *target)
 {
-	move_current_and_update_token(&current, &token);
-	if (exec->outfile)
-		free(exec->outfile);
-	exec->outfile = ft_strdup(token->lexeme);
-	if (!exec->outfile)
-		exec_errors(data, exec, 1);
-	check_file_exist_child(data, exec);
-	return (current);
-}
+	t_redir	*redir;
+	t_list	*node;
 
-/*If a redirection symbol '<' meaning the input should be redirected, 
-it saves the information in the bool exec->redir_in and stores the filename 
-of the new input source in exec->infile.*/
-static t_list	*redirect_in(t_data *data, t_exec *exec, t_list *current, \
-t_token *token)
-{
-	exec->redir_in = 1;
-	move_current_and_update_token(&current, &token);
-	if (exec->infile)
-		free(exec->infile);
-	exec->infile = ft_strdup(token->lexeme);
-	if (!exec->infile)
+	redir = malloc(sizeof(t_redir));
+	if (!redir)
+		exec_errors(data, exec, 1);
+	redir->fd = get_redir_fd(op);
+	redir->type = op->type;
+	redir->target = target->lexeme;
+	node = ft_lstnew(redir);
+	if (!node)
+	{
+		free(redir);
 		exec_errors(data, exec, 1);
-	check_file_exist_child(data, exec);
-	return (current);
+	}
+	ft_lstadd_back(&exec->redirs, node);
 }
 
-/*Checks if there are any redirections '>' or '<' happening in the input.*/
-void	check_redirections(t_data *data, t_exec *exec, int position)
+/*Goes through all tokens of the command starting at 'position' (up until the
+next pipe) and stores its redirections in exec->redirs, in the order they
+appear in - as they have to be applied in that order ('>f 2>&1' is not the
+same as '2>&1 >f').*/
+void	collect_redirections(t_data *data, t_exec *exec, int position)
 {
 	t_list	*current;
 	t_token	*token;
@@ -64,18 +50,59 @@ void	check_redirections(t_data *data, t_exec *exec, int position)
 		move_current_and_update_token(&current, &token);
 	while (current && token->type != PIPE)
 	{
-		if (token->type == REDIR_IN)
-			current = redirect_in(data, exec, current, token);
-		else if (token->type == REDIR_OUT)
+		if (is_redir_token(token->type))
 		{
-			reset_redir_or_append_out(exec, 0);
-			current = redirect_out(data, exec, current, token);
+			add_redir(data, exec, token, (t_token *)current->next->content);
+			move_current_and_update_token(&current, &token);
 		}
-		else if (token->type == APPEND_OUT)
+		move_current_and_update_token(&current, &token);
+	}
+}
+
+/*Opens the target of a redirection exactly once, already with the final
+flags: '<' opens the file for reading, '<>' for reading and writing, '>' and
+'&>' create and truncate it, '>>' and '&>>' create it and append to it.
+There is no need to check for the file's existence beforehand, as open()
+reports any error itself.
+Returns the new file descriptor, or -1 if opening failed.*/
+int	open_redirection(t_redir *redir)
+{
+	int	flags;
+
+	if (redir->type == REDIR_IN)
+		return (open(redir->target, O_RDONLY | O_CLOEXEC));
+	if (redir->type == REDIR_RW)
+		flags = O_RDWR | O_CREAT;
+	else if (redir->type == APPEND_OUT || redir->type == ALL_APPEND)
+		flags = O_WRONLY | O_CREAT | O_APPEND;
+	else
+		flags = O_WRONLY | O_CREAT | O_TRUNC;
+	return (open(redir->target, flags | O_CLOEXEC, 0644));
+}
+
+/*Used for builtins running in the parent, where redirections are not applied:
+Opens (and closes again) the file targets of all redirections in order, so
+output files get created and an error is reported - just like in bash.
+Returns 1 if all targets could be opened, 0 otherwise.*/
+int	check_redirections(t_data *data, t_exec *exec)
+{
+	t_list	*current;
+	t_redir	*redir;
+	int		fd;
+
+	current = exec->redirs;
+	while (current)
+	{
+		redir = (t_redir *)current->content;
+		if (redir->type != DUP_IN && redir->type != DUP_OUT
+			&& redir->type != HERESTRING)
 		{
-			reset_redir_or_append_out(exec, 1);
-			current = redirect_out(data, exec, current, token);
+			fd = open_redirection(redir);
+			if (fd == -1)
+				return (redirections_errors(data, exec, redir->target, 1));
+			close(fd);
 		}
-		move_current_and_update_token(&current, &token);
+		current = current->next;
 	}
+	return (1);
 }
@@ -1,14 +1,12 @@
 #include "minishell.h"
 
-/*Prints an error message if a file doesn't exist, or something goes 
-wrong in the redirection.*/
-void	redirections_errors(t_data *data, t_exec *exec, int std, int parent)
+/*Prints an error message if a redirection target cannot be opened (e.g. it
+doesn't exist), or something else goes wrong in the redirection. Exits the
+process if it's a child process, otherwise returns 0.*/
+int	redirections_errors(t_data *data, t_exec *exec, char *file, int parent)
 {
 	ft_putstr_fd(ERR_PREFIX, 2);
-	if (!std)
-		ft_putstr_fd(exec->infile, 2);
-	else if (std)
-		ft_putstr_fd(exec->outfile, 2);
+	ft_putstr_fd(file, 2);
 	ft_putstr_fd(": ", 2);
 	perror("");
 	if (!parent)
@@ -17,6 +15,7 @@ void	redirections_errors(t_data *data, t_exec *exec, int std, int parent)
 		free_data(data, 1);
 		exit(1);
 	}
+	return (0);
 }
 
 /*Prints an error message an exits the process if the command is not found*/
@@ -58,8 +57,6 @@ static void	execve_failure(t_data *data, t_exec *exec)
 	else if (errno == 20 || errno == 13)
 		exit_code = 126;
 	perror("");
-	close(exec->outfile_fd);
-	close(exec->infile_fd);
 	free_exec(exec);
 	free_data(data, 1);
 	exit(exit_code);
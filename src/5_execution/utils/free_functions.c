@@ -17,9 +17,13 @@ int	free_exec(t_exec *exec)
 	if (exec)
 	{
 		if (exec->all_paths)
-			ft_freearray(exec->all_paths);
+			free(exec->all_paths);
 		if (exec->child)
 			free_children(exec->child);
+		if (exec->pipes)
+			free(exec->pipes);
+		if (exec->redirs)
+			ft_lstclear(&exec->redirs, free);
 		if (exec->cmd)
 			free(exec->cmd);
 		if (exec->current_path)
@@ -30,10 +34,7 @@ int	free_exec(t_exec *exec)
 			ft_freearray(exec->input);
 		if (exec->envp_temp_arr)
 			ft_freearray(exec->envp_temp_arr);
-		if (exec->infile)
-			free(exec->infile);
-		if (exec->outfile)
-			free(exec->outfile);
+		ft_sb_free(&exec->out);
 		free(exec);
 	}
 	return (0);
@@ -0,0 +1,103 @@
+/**
+This file contains the functions for reading commands without a terminal:
+If minishell is started with a script (`./minishell script.sh`) or its input
+is not a terminal (e.g. `... | ./minishell`), it runs non-interactively and
+reads its input line by line with a gnl_reader, instead of readline (no
+prompt, no logo, no history).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	init_input(t_data *data);
+char	*read_script_line(t_data *data);
+void	sync_script_input(t_data *data);
+
+/**
+Used in init_data_struct().
+
+Decides whether minishell runs interactively and, if it doesn't, prepares
+the reader for the script or the standard input.
+A script gets read in large blocks, as its fd is not shared with any command.
+The standard input is shared with the commands though: If it is a file, it is
+read in large blocks as well, and handed back to the commands at the end of
+the current line by sync_script_input(). A pipe can't be rewound, so in this
+case it is read byte by byte (like bash does), to never consume any input
+meant for the commands.
+
+ @param data 	Pointer to the data struct.
+*/
+void	init_input(t_data *data)
+{
+	int		fd;
+	size_t	chunk;
+
+	data->interactive = (data->argc < 2 && isatty(STDIN_FILENO));
+	if (data->interactive)
+		return ;
+	fd = STDIN_FILENO;
+	chunk = GNL_READER_SIZE;
+	if (data->argc >= 2)
+		fd = open(data->argv[1], O_RDONLY | O_CLOEXEC);
+	else if (lseek(STDIN_FILENO, 0, SEEK_CUR) == -1)
+		chunk = 1;
+	if (fd == -1)
+	{
+		print_err_msg_prefix(data->argv[1]);
+		free_data(data, 1);
+		exit(EKEYEXPIRED);
+	}
+	if (!ft_gnl_open(&data->script, fd, chunk))
+	{
+		print_err_msg(ERR_READ_SCRIPT);
+		free_data(data, 1);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/**
+Reads the next line of the script or the standard input, replacing readline()
+in non-interactive mode (for the minishell prompt and the heredoc prompt).
+
+ @param data 	Pointer to the data struct.
+
+ @return	A copy of the line (without the newline), which needs to be freed.
+			`NULL` at the end of the input or if reading failed (which also
+			sets the exit status to `1`).
+*/
+char	*read_script_line(t_data *data)
+{
+	const char	*line;
+	size_t		len;
+	int			ret;
+	char		*input;
+
+	ret = ft_gnl_next(&data->script, &line, &len);
+	if (ret == 0)
+		return (NULL);
+	input = NULL;
+	if (ret == 1)
+		input = ft_strndup(line, len);
+	if (!input)
+	{
+		print_err_msg(ERR_READ_SCRIPT);
+		data->exit_status = 1;
+	}
+	return (input);
+}
+
+/**
+Used in main().
+
+Hands the part of the standard input that was read ahead (beyond the current
+line and its heredocs) back to it, before commands get executed, so commands
+reading their standard input continue right after the current line.
+
+ @param data 	Pointer to the data struct.
+*/
+void	sync_script_input(t_data *data)
+{
+	if (!data->interactive && data->script.fd == STDIN_FILENO)
+		ft_gnl_sync(&data->script);
+}
@@ -83,13 +83,21 @@ This function uses the `readline` library to show a prompt (specified by
 the `PROMPT` macro) and captures the user's input. If the user signals an
 intention to exit (e.g., by pressing Ctrl+D), the function calls
 `process_exit_signal` to handle the termination gracefully.
+In non-interactive mode, the next line of the script is read instead, and the
+end of the script is handled the same way.
 
  @param data 	A pointer to the data structure. The user's input will be
  				stored in the `input` field of this structure.
 */
 void	minishell_prompt(t_data *data)
 {
-	data->input = readline(PROMPT);
+	if (data->interactive)
+	{
+		data->input = readline(PROMPT);
+		ft_ms_adopt(data->input);
+	}
+	else
+		data->input = read_script_line(data);
 	if (!data->input)
 		handle_eot(data);
 }
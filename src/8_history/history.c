@@ -22,44 +22,53 @@ static void	history_errors(char *str, int error_code, int fd)
 }
 
 /*Adds whatever input is there into the file '.minishell_history', to save
-it for later.*/
+it for later. The line and its newline are appended with a single writev(),
+instead of one write() per byte, which is on the path from pressing Enter to
+the command running.*/
 void	add_history_to_file(char *input, char *path_to_hist_file)
 {
-	int	i;
-	int	fd;
+	int				fd;
+	struct iovec	iov[2];
 
-	i = 0;
-	fd = 0;
-	if (access(path_to_hist_file, F_OK) == -1)
-		fd = open(path_to_hist_file, O_CREAT | O_APPEND | O_WRONLY, 0644);
-	else
-		fd = open(path_to_hist_file, O_APPEND | O_WRONLY, 0644);
+	add_history(input);
+	fd = open(path_to_hist_file, O_CREAT | O_APPEND | O_WRONLY | O_CLOEXEC,
+			0644);
 	if (fd == -1)
+	{
 		history_errors(NULL, 1, fd);
-	while (input[i])
-		write(fd, &input[i++], 1);
-	write(fd, "\n", 1);
+		return ;
+	}
+	iov[0].iov_base = input;
+	iov[0].iov_len = ft_strlen(input);
+	iov[1].iov_base = "\n";
+	iov[1].iov_len = 1;
+	writev(fd, iov, 2);
 	close(fd);
-	add_history(input);
 }
 
 /*Adds command history from the file '.minishell_history' into the minishell
 history (arrow keys up and down). This ensures that commands from previous
-minishell sessions are saved, the same way as in bash.*/
-void	init_add_history_from_file(char *tmp, char *input, int fd)
+minishell sessions are saved, the same way as in bash.
+The file is read with a gnl_reader, so the lines are not copied: readline's
+add_history() makes its own copy anyway.*/
+static void	add_history_from_file(int fd)
 {
-	while (1)
+	t_gnl_reader	reader;
+	const char		*line;
+	size_t			len;
+	int				ret;
+
+	if (!ft_gnl_open(&reader, fd, GNL_READER_SIZE))
+		history_errors(NULL, 2, fd);
+	ret = ft_gnl_next(&reader, &line, &len);
+	while (ret == 1)
 	{
-		free(input);
-		free(tmp);
-		tmp = get_next_line(fd);
-		if (!tmp)
-			break ;
-		input = ft_substr(tmp, 0, ft_strlen(tmp) - 1);
-		if (!input)
-			history_errors(tmp, 2, fd);
-		add_history(input);
+		add_history(line);
+		ret = ft_gnl_next(&reader, &line, &len);
 	}
+	ft_gnl_close(&reader);
+	if (ret == -1)
+		history_errors(NULL, 2, fd);
 }
 
 /*Initializes the path_to_hist_file, meaning the absolute path to a file
@@ -70,26 +79,17 @@ in the history current minishell session.*/
 char	*init_history(t_data *data)
 {
 	int		fd;
-	char	*input;
-	char	*tmp;
 
 	fd = 0;
 	set_path_to_file(data, &data->path_to_hist_file, HIST_FILE, ERR_HIST_FILE);
 	if (access(data->path_to_hist_file, F_OK) == -1)
-		fd = open(data->path_to_hist_file, O_CREAT | O_APPEND | O_WRONLY, 0644);
+		fd = open(data->path_to_hist_file,
+				O_CREAT | O_APPEND | O_WRONLY | O_CLOEXEC, 0644);
 	else
-		fd = open(data->path_to_hist_file, O_RDONLY);
+		fd = open(data->path_to_hist_file, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
 		history_errors(NULL, 1, 0);
-	tmp = get_next_line(fd);
-	if (!tmp)
-		history_errors(NULL, 2, fd);
-	input = ft_substr(tmp, 0, ft_strlen(tmp) - 1);
-	if (!input)
-		history_errors(tmp, 2, fd);
-	if (input)
-		add_history(input);
-	init_add_history_from_file(tmp, input, fd);
+	add_history_from_file(fd);
 	close(fd);
 	return (data->path_to_hist_file);
 }
@@ -0,0 +1,110 @@
+/**
+This file contains the report of the allocation accounting, which is compiled
+in via 'make MEMSTAT=1' (see ft_memstat.c in libft): the bytes currently
+allocated by the shell, their peak, and the allocations of each phase of
+processing command lines (see `t_phase`), e.g.
+
+	live	20480 bytes in 117 blocks
+	peak	71552 bytes
+	total	1623 allocs, 1506 frees
+	tokens	212 allocs, 6784 bytes
+
+The report is printed by the builtin `memstat` and when minishell exits, where
+the bytes still allocated are the ones leaked (or freed by the OS on exit).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	memstat_init(void);
+int		memstat_report(t_strbuf *sb);
+void	memstat_finish(void);
+
+/**
+Used in main().
+
+Marks the counters as the shell's own (child processes inherit a copy) and
+counts the allocations made during startup in `PH_OTHER`.
+*/
+void	memstat_init(void)
+{
+	ft_memstat()->owner = getpid();
+	ft_ms_phase(PH_OTHER);
+}
+
+/**
+Used in memstat_report().
+
+Adds a line with the allocations of each phase that allocated anything.
+
+ @param sb 	The report.
+ @param ms 	The counters.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	add_phases(t_strbuf *sb, t_memstat *ms)
+{
+	int	ok;
+	int	phase;
+
+	ok = 1;
+	phase = -1;
+	while (++phase < PH_COUNT)
+	{
+		if (!ms->phase_allocs[phase])
+			continue ;
+		ok = ok && ft_sb_adds(sb, trace_phase_name(phase))
+			&& ft_sb_addc(sb, '\t')
+			&& ft_sb_addunbr(sb, ms->phase_allocs[phase])
+			&& ft_sb_adds(sb, " allocs, ")
+			&& ft_sb_addunbr(sb, ms->phase_bytes[phase])
+			&& ft_sb_adds(sb, " bytes\n");
+	}
+	return (ok);
+}
+
+/**
+Adds the current state of the counters to an empty report. The counters are
+copied first, so the allocations made for the report itself are not part of
+it.
+
+ @param sb 	The report.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+int	memstat_report(t_strbuf *sb)
+{
+	t_memstat	ms;
+
+	ms = *ft_memstat();
+	return (ft_sb_adds(sb, "live\t") && ft_sb_addunbr(sb, ms.live)
+		&& ft_sb_adds(sb, " bytes in ")
+		&& ft_sb_addunbr(sb, ms.allocs - ms.frees)
+		&& ft_sb_adds(sb, " blocks\npeak\t") && ft_sb_addunbr(sb, ms.peak)
+		&& ft_sb_adds(sb, " bytes\ntotal\t") && ft_sb_addunbr(sb, ms.allocs)
+		&& ft_sb_adds(sb, " allocs, ") && ft_sb_addunbr(sb, ms.frees)
+		&& ft_sb_adds(sb, " frees\n") && add_phases(sb, &ms));
+}
+
+/**
+Used in free_data().
+
+Reports the counters on stderr when the shell itself (not one of its child
+processes) exits, after all of its memory was freed. Does nothing in a build
+without MEMSTAT.
+*/
+void	memstat_finish(void)
+{
+	t_strbuf	sb;
+
+	if (!FT_MEMSTAT || ft_memstat()->owner != getpid())
+		return ;
+	ft_sb_init(&sb);
+	if (memstat_report(&sb))
+	{
+		ft_putstr_fd("[memstat] at exit:\n", STDERR_FILENO);
+		write(STDERR_FILENO, sb.buf, sb.len);
+	}
+	ft_sb_free(&sb);
+}
@@ -0,0 +1,92 @@
+/**
+This file contains the setup and teardown of the per-phase latency trace,
+which is enabled via the TRACE_VAR environment variable (see config.h):
+
+	MINISHELL_TRACE=1 ./minishell			-> reports on stderr
+	MINISHELL_TRACE=trace.log ./minishell	-> reports appended to trace.log
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	trace_init(t_data *data);
+void	trace_finish(t_data *data);
+
+/**
+Used in trace_init().
+
+Opens the destination of the trace reports.
+
+ @param value 	The value of TRACE_VAR: `1` for stderr, otherwise a file path.
+
+ @return	The fd to write the reports to.
+			`-1` if the file can't be opened.
+*/
+static int	open_trace_fd(const char *value)
+{
+	if (ft_strcmp(value, "1") == 0)
+		return (STDERR_FILENO);
+	return (open(value, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644));
+}
+
+/**
+Used in main().
+
+Enables the trace if TRACE_VAR is set (and not empty or `0`). The trace
+state is placed in an anonymous shared mapping, so child processes created
+later add their timings to the same counters the shell reports.
+If the trace can't be set up, a warning is printed and minishell runs
+without it.
+
+ @param data 	Pointer to the data struct.
+*/
+void	trace_init(t_data *data)
+{
+	char	*value;
+	t_trace	*trace;
+
+	data->trace = NULL;
+	value = get_env_value(data->envp_temp, TRACE_VAR);
+	if (!value || !*value || ft_strcmp(value, "0") == 0)
+		return ;
+	trace = mmap(NULL, sizeof(t_trace), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (trace == MAP_FAILED)
+	{
+		print_err_msg_prefix(TRACE_VAR);
+		return ;
+	}
+	ft_bzero(trace, sizeof(t_trace));
+	trace->owner = getpid();
+	trace->fd = open_trace_fd(value);
+	if (trace->fd == -1)
+	{
+		print_err_msg_prefix(value);
+		munmap(trace, sizeof(t_trace));
+		return ;
+	}
+	data->trace = trace;
+}
+
+/**
+Used in free_data().
+
+Disables the trace when a process exits. If it is the shell itself (and not
+one of its child processes), the histograms of all phases are reported first.
+
+ @param data 	Pointer to the data struct.
+*/
+void	trace_finish(t_data *data)
+{
+	if (!data->trace)
+		return ;
+	if (data->trace->owner == getpid())
+	{
+		trace_summary(data);
+		if (data->trace->fd != STDERR_FILENO)
+			close(data->trace->fd);
+	}
+	munmap(data->trace, sizeof(t_trace));
+	data->trace = NULL;
+}
@@ -0,0 +1,104 @@
+/**
+This file contains the functions measuring the phases of a command line for
+the latency trace. All of them do nothing if the trace is not enabled.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+unsigned long	trace_now(t_data *data);
+void			trace_add(t_data *data, t_phase phase, unsigned long start);
+int				trace_call(t_data *data, t_phase phase, int (*f)(t_data *));
+void			trace_lap(t_data *data);
+void			trace_mark(t_data *data, t_phase phase, t_phase next);
+
+/**
+Reads the monotonic clock, which (unlike the wall clock) is not affected by
+changes of the system time.
+
+ @param data 	Pointer to the data struct.
+
+ @return	The current time in nanoseconds.
+			`0` if the trace is not enabled.
+*/
+unsigned long	trace_now(t_data *data)
+{
+	struct timespec	ts;
+
+	if (!data->trace)
+		return (0);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((unsigned long)ts.tv_sec * 1000000000UL + ts.tv_nsec);
+}
+
+/**
+Adds the time since `start` to a phase of the current line. As child
+processes add to the shared trace concurrently, the addition is atomic.
+
+ @param data 	Pointer to the data struct.
+ @param phase 	The phase to add the time to.
+ @param start 	The start of the measured interval, from trace_now().
+*/
+void	trace_add(t_data *data, t_phase phase, unsigned long start)
+{
+	if (!data->trace)
+		return ;
+	__atomic_fetch_add(&data->trace->line_ns[phase], trace_now(data) - start,
+		__ATOMIC_RELAXED);
+}
+
+/**
+Calls a function of a phase and measures its duration, e.g.
+`trace_call(data, PH_TOKENS, get_tokens)`. Allocations made by `f` are
+counted in the phase as well (see memstat.c).
+
+ @param data 	Pointer to the data struct, passed on to `f`.
+ @param phase 	The phase `f` belongs to.
+ @param f 		The function to call.
+
+ @return	The return value of `f`.
+*/
+int	trace_call(t_data *data, t_phase phase, int (*f)(t_data *))
+{
+	unsigned long	start;
+	int				previous;
+	int				ret;
+
+	start = trace_now(data);
+	previous = ft_ms_phase(phase);
+	ret = f(data);
+	ft_ms_phase(previous);
+	trace_add(data, phase, start);
+	return (ret);
+}
+
+/**
+Starts measuring a sequence of consecutive phases in the shell process (see
+trace_mark()), beginning with `PH_PLAN`.
+
+ @param data 	Pointer to the data struct.
+*/
+void	trace_lap(t_data *data)
+{
+	ft_ms_phase(PH_PLAN);
+	if (data->trace)
+		data->trace->lap = trace_now(data);
+}
+
+/**
+Ends a phase that started with the previous trace_lap() or trace_mark(),
+and starts the next one. Only used in the shell process itself.
+
+ @param data 	Pointer to the data struct.
+ @param phase 	The phase that just ended.
+ @param next 	The phase that starts (`PH_OTHER` after the last one).
+*/
+void	trace_mark(t_data *data, t_phase phase, t_phase next)
+{
+	ft_ms_phase(next);
+	if (!data->trace)
+		return ;
+	trace_add(data, phase, data->trace->lap);
+	data->trace->lap = trace_now(data);
+}
@@ -4,6 +4,29 @@
 
 volatile __sig_atomic_t	g_signal = 0;
 
+/*
+Processes one (non-empty) line of input: adds it to the history, checks it,
+splits it into tokens (or takes them from the parse cache, if the line was
+entered before), parses and executes them. A line with control flow (`;`,
+`if`, `while`, `until`, `for`) is parsed into a command list first. If the
+line is prefixed with `time`, its timing is reported once it finished. With
+MINISHELL_TRACE set, the time spent in each of these phases is reported
+afterwards.
+*/
+static void	handle_input(t_data *data)
+{
+	unsigned long	start;
+
+	start = trace_now(data);
+	if (data->interactive)
+		add_history_to_file(data->input, data->path_to_hist_file);
+	if (!is_only_whitespace(data->input)
+		&& get_cached_tokens(data) && strip_time_keyword(data))
+		run_tokens(data);
+	report_timing(data);
+	trace_line_end(data, start);
+}
+
 /*
 main is first of all a loop that runs the shell taking inputs from the user
 and executing them until the user decides to exit it.
@@ -12,7 +35,7 @@ int	main(int argc, char **argv, char **envp)
 {
 	t_data	data;
 
-	print_logo();
+	memstat_init();
 	init_data_struct(&data, argc, argv, envp);
 	while (1)
 	{
@@ -21,15 +44,7 @@ int	main(int argc, char **argv, char **envp)
 		handle_g_signal(&data);
 		handle_signals_heredoc();
 		if (data.input && !is_empty(data.input))
-		{
-			add_history_to_file(data.input, data.path_to_hist_file);
-			if (!is_only_whitespace(data.input) && is_quotation_closed(&data)
-				&& get_tokens(&data) && parse_tokens(&data))
-			{
-				handle_signals_exec();
-				init_exec(&data);
-			}
-		}
+			handle_input(&data);
 		cleanup(&data, 0);
 	}
 }
@@ -34,11 +34,29 @@ static void	get_cwd(t_data *data)
 	}
 }
 
+/**
+Initializes the members of the token management struct.
+
+ @param tok 	Pointer to the `tok` member of the data structure.
+*/
+static void	init_tok(t_tok *tok)
+{
+	tok->tok = NULL;
+	tok->tmp = NULL;
+	tok->new_node = NULL;
+	tok->tok_lst = NULL;
+	tok->tok_last = NULL;
+	tok->curr_node = NULL;
+	tok->curr_tok = NULL;
+	tok->next_tok = NULL;
+}
+
 /**
 Used in main().
 
 Initializes members of all data structures to starting values.
 This helps to prevent accessing uninitialized variables.
+The logo is only printed and the history only loaded in interactive mode.
 */
 void	init_data_struct(t_data *data, int argc, char **argv, char **envp)
 {
@@ -50,20 +68,22 @@ void	init_data_struct(t_data *data, int argc, char **argv, char **envp)
 	data->exit_status = 0;
 	data->working_dir = NULL;
 	data->path_to_hist_file = NULL;
-	data->tok.tok = NULL;
-	data->tok.tmp = NULL;
-	data->tok.quote = '\0';
-	data->tok.new_node = NULL;
-	data->tok.tok_lst = NULL;
-	data->tok.curr_node = NULL;
-	data->tok.curr_tok = NULL;
-	data->tok.next_tok = NULL;
-	data->envp_temp = NULL;
+	init_tok(&data->tok);
+	ft_bzero(&data->cache, sizeof(t_parse_cache));
 	data->envp_temp = init_env_tmp(envp);
-	data->export_list = NULL;
 	data->export_list = init_export_list(data);
-	data->quote.in_single = false;
-	data->quote.in_double = false;
+	trace_init(data);
+	ft_bzero(&data->quote, sizeof(t_quote));
+	data->procsubst = NULL;
+	data->heredoc_lines = NULL;
+	data->script.buf = NULL;
+	data->program = NULL;
+	data->timing.active = false;
 	get_cwd(data);
-	data->path_to_hist_file = init_history(data);
+	init_input(data);
+	if (data->interactive)
+	{
+		print_logo();
+		data->path_to_hist_file = init_history(data);
+	}
 }
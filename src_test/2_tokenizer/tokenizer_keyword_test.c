@@ -0,0 +1,66 @@
+/**
+This file contains the handling of the reserved word `time`, which can
+precede a command line to report how long it took (see time.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	strip_time_keyword(t_data *data);
+
+/**
+Used in strip_time_keyword().
+
+Removes the first token from the token list and renumbers the remaining ones,
+so the positions still start at `0`.
+
+ @param data 	Pointer to the data structure containing the token list.
+*/
+static void	pop_first_token(t_data *data)
+{
+	t_list	*first;
+	t_list	*current;
+
+	first = data->tok.tok_lst;
+	data->tok.tok_lst = first->next;
+	if (data->tok.tok_last == first)
+		data->tok.tok_last = NULL;
+	ft_lstdelone(first, del_token);
+	current = data->tok.tok_lst;
+	while (current)
+	{
+		((t_token *)current->content)->position--;
+		current = current->next;
+	}
+}
+
+/**
+Checks if the command line starts with the reserved word `time` (unquoted, so
+`"time"` still runs a command called time). If so, the word is removed from
+the token list and the timing of the rest of the line is started. A pipeline
+must not start with `|` after `time` either, which the tokenizer could not
+tell as `time` was still in front of it.
+
+ @param data 	Pointer to the data structure containing the token list.
+
+ @return	`1` if there is something to execute.
+			`0` if the line only consisted of `time` or `time` is followed by
+			`|` (an error message was printed).
+*/
+int	strip_time_keyword(t_data *data)
+{
+	t_token	*first;
+
+	if (!data->tok.tok_lst)
+		return (1);
+	first = (t_token *)data->tok.tok_lst->content;
+	if (first->type != OTHER || ft_strcmp(first->lexeme, "time") != 0)
+		return (1);
+	if (data->tok.tok_lst->next
+		&& ((t_token *)data->tok.tok_lst->next->content)->type == PIPE)
+		return (syntax_error(data, data->tok.tok_lst->next));
+	start_timing(data);
+	pop_first_token(data);
+	return (data->tok.tok_lst != NULL);
+}
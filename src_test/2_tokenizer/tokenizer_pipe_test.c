@@ -18,7 +18,7 @@ Mostly a simplified version of is_valid_operand() in tokenizer_redirection.c.
 
 Scans the input string starting from the current index (*i).
 Skips any leading whitespace and checks if the encountered character is valid.
-Valid syntax after a pipe: Anything but '|' and end of input ('\0').
+Valid syntax after a pipe: Anything but '|', ';' and end of input ('\0').
 
  @param inp 	The input string containing the command line input.
  @param i 		The current index in the input string.
@@ -39,7 +39,8 @@ static char	*is_valid_syntax(t_data *data, int j)
 		j++;
 	// Check for invalid syntax ('empty' string after '|')
 	if (data->input[j] == '|' || data->input[j] == '&'
-		|| data->input[j] == '!' || data->input[j] == '\0')
+		|| data->input[j] == '!' || data->input[j] == ';'
+		|| data->input[j] == '\0')
 	{
 		// Allocate memory for the invalid syntax string
 		invalid_syn = malloc(sizeof(char) * (ft_strlen("newline") + 1)); // Allocate for "newline" + null terminator
@@ -120,14 +121,14 @@ static int	check_syntax(t_data *data, int j)
 	char	*str_j; // String to hold the position of failed piping.
 
 	invalid_syn = is_valid_syntax(data, j); // Check if the syntax is valid.
-	if (invalid_syn != NULL || data->tok.tok_lst == NULL) // If invalid syntax is found OR if 'pipe' token would be the first token.
+	if (invalid_syn != NULL || is_command_start(data)) // If invalid syntax is found OR if 'pipe' token would be the first token.
 	{
 		str_j = ft_itoa(j);
 		if (!str_j)
 			str_j = "-1"; // set to position to '-1' if malloc in ft_itoa() fails
 		if (ft_strcmp(str_j, "-1") == 0) // allocation for position failed
 			print_err_msg(ERR_MALLOC);
-		if (data->tok.tok_lst == NULL) // tok_lst is not created if '|' is the first non-whitespace char encountered in the input string
+		if (is_command_start(data)) // tok_lst is not created if '|' is the first non-whitespace char encountered in the input string
 			print_pipe_err_msg(invalid_syn, str_j, data, 1);
 		else
 		{
@@ -145,7 +146,7 @@ static int	check_syntax(t_data *data, int j)
 /**
 If the character at index *i in the input string is a pipe symbol ('|'),
 the function checks if the syntax before and after the '|' is valid.
-Input before and after a pipe cannot be empty.
+Input before and after a pipe cannot be empty (nor a ';').
 Our minishell interprets '||' as "empty input between pipes" not as
 "OR" operator.
 
@@ -175,7 +176,7 @@ int	is_pipe(t_data *data, int *i)
 				free_unlinked_token(data); // Frees dangling token not added to linked list
 				return (0); // Token creation failed.
 			}
-			ft_lstadd_back(&data->tok.tok_lst, data->tok.new_node);
+			add_token(data);
 			return (1); // Pipe token added to token list.
 		}
 		else
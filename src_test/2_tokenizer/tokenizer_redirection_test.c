@@ -16,10 +16,12 @@ Used in check_operand().
 
 Scans the input string starting from the current index (*i).
 Skips any leading whitespace and checks if the encountered character is valid.
-Valid redirections are: `>`, `>>`, `<`, `<<`.
+Valid redirections are: `>`, `>>`, `<`, `<<`, `<<<`, `<>`, `>|`, `<&`, `>&`,
+`&>` and `&>>`, optionally prefixed by a fd number (e.g. `2>`, `2>&1`).
 Redirection cannot be the last part of the input string, a valid operand
 is needed.
-Valid operands (files) cannot be or start with `>`, `<`, or `|`.
+Valid operands (files) cannot be or start with `>`, `<`, `|` or `;`, except
+for process substitutions (e.g. `< <(ls)`).
 
  @param inp 	The input string containing the command line input.
  @param i 		The current index in the input string.
@@ -39,7 +41,8 @@ static char	*is_valid_operand(const char *inp, int *i)
 	while (is_whitespace(inp[j])) // Skip leading whitespace
 		j++;
 	// Check for invalid operands or end of input string (expecting a file)
-	if (inp[j] == '>' || inp[j] == '<' || inp[j] == '|' || inp[j] == '\0')
+	if (((inp[j] == '>' || inp[j] == '<') && inp[j + 1] != '(')
+		|| inp[j] == '|' || inp[j] == ';' || inp[j] == '\0')
 	{
 		// Allocate memory for the invalid operand string
 		invalid_op = malloc(sizeof(char) * 8); // Allocate for "newline" + null terminator
@@ -67,23 +70,18 @@ and updates the `errno` accordingly.
  @param invalid_op 	The invalid operand encountered in the input.
  @param input 		The input string containing the command line input.
  @param str_j 		The string representation of int j.
- @param j 			Position index of the failed redirection in the input string.
+ @param op 			The redirection operator (including a leading fd number).
 */
 static void	print_redir_err_msg(char *invalid_op, t_data *data,
-	char *str_j, int j)
+	char *str_j, const char *op)
 {
 	ft_putstr_fd(ERR_COLOR, STDERR_FILENO); // Set error color for the output
 	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
 	ft_putstr_fd(ERR_SYNTAX, STDERR_FILENO);
 	// Print the specific redirection operator encountered
-	if (data->input[j] == '>' && data->input[j + 1] == '>')
-		ft_putstr_fd("'>>': '", STDERR_FILENO);
-	else if (data->input[j] == '>')
-		ft_putstr_fd("'>': '", STDERR_FILENO);
-	else if (data->input[j] == '<' && data->input[j + 1] == '<')
-		ft_putstr_fd("'<<': '", STDERR_FILENO);
-	else if (data->input[j] == '<')
-		ft_putstr_fd("'<': '", STDERR_FILENO);
+	ft_putstr_fd("'", STDERR_FILENO);
+	ft_putstr_fd((char *)op, STDERR_FILENO);
+	ft_putstr_fd("': '", STDERR_FILENO);
 	ft_putstr_fd(invalid_op, STDERR_FILENO); // Print the invalid operand
 	ft_putstr_fd("' (position: ", STDERR_FILENO);
 	ft_putstr_fd(str_j, STDERR_FILENO); // Print the position of failed redirection
@@ -104,11 +102,12 @@ in these cases).
  @param input 	The input string containing the command line input.
  @param i 		Pointer to the current index in the input string.
  @param j 		The index of the redirection operator in the input string.
+ @param op 		The redirection operator (including a leading fd number).
 
  @return	`0` if an invalid operand is found and an error message is printed.
 			`1` if the operand is valid.
 */
-static int	check_operand(t_data *data, int *i, int j)
+static int	check_operand(t_data *data, int *i, int j, const char *op)
 {
 	char	*invalid_op; // String for the invalid operand
 	char	*str_j; // String to hold the position of failed redirection
@@ -121,12 +120,12 @@ static int	check_operand(t_data *data, int *i, int j)
 			print_err_msg(ERR_MALLOC);
 		if (!str_j)
 		{
-			print_redir_err_msg(invalid_op, data, "-1", j);
+			print_redir_err_msg(invalid_op, data, "-1", op);
 			if (ft_strcmp(invalid_op, "ERR") != 0) // check if invalid_op was dynamically allocated
 				free(invalid_op);
 			return (0); // Invalid syntax was found, pos: -1
 		}
-		print_redir_err_msg(invalid_op, data, str_j, j);
+		print_redir_err_msg(invalid_op, data, str_j, op);
 		if (ft_strcmp(invalid_op, "ERR") != 0) // check if invalid_op was dynamically allocated
 			free(invalid_op);
 		free(str_j);
@@ -157,12 +156,15 @@ static int	create_redirection_token(t_data *data, int *i, t_token_type type,
 		free_unlinked_token(data); // Frees dangling token not added to linked list
 		return (0);
 	}
-	ft_lstadd_back(&data->tok.tok_lst, data->tok.new_node);
+	add_token(data);
 	return (1);
 }
 
 /**
 Checks for redirection operators in the input string starting from index *i.
+A redirection operator can be prefixed by the fd number it applies to
+(e.g. `2>`), digits are only part of the operator if they are directly
+followed by `<` or `>`.
 If a redirection operator is found, it creates the corresponding token and adds
 it to the token list. It also checks for a valid operand (file) after the
 redirection operator.
@@ -177,26 +179,28 @@ redirection operator.
 */
 int	is_redirection(t_data *data, int *i)
 {
-	int	j;
-	int	token_created; // Flag to indicate status of token creation
+	t_token_type	type;
+	char			*op; // operator incl. a leading fd number, e.g. "2>"
+	int				op_len;
+	int				j;
 
+	j = *i;
+	while (ft_isdigit(data->input[j])) // Skip a potential fd number
+		j++;
+	if (j > *i && data->input[j] != '<' && data->input[j] != '>')
+		return (1); // Digits not followed by a redirection: a regular word
+	op_len = get_redirection_op(&data->input[j], &type);
+	if (!op_len)
+		return (1); // No redirection found
+	op = ft_strndup(data->input + *i, j - *i + op_len);
+	if (!op)
+		return (0); // Malloc fail
 	j = *i; // Store the initial index value
-	// Check for different redirection operators and create corresponding tokens
-	if (data->input[*i] == '>' && data->input[*i + 1] == '>')
-		token_created = create_redirection_token(data, i, APPEND_OUT, ">>");
-	else if (data->input[*i] == '>')
-		token_created = create_redirection_token(data, i, REDIR_OUT, ">");
-	else if (data->input[*i] == '<' && data->input[*i + 1] == '<')
-		token_created = create_redirection_token(data, i, HEREDOC, "<<");
-	else if (data->input[*i] == '<')
-		token_created = create_redirection_token(data, i, REDIR_IN, "<");
-	// Check if a redirection was found and validate its operand
-	if (j != *i) // If *i has been incremented, it means a redirection was found
-	{
-		if (!check_operand(data, i, j))
-			return (-1); // The operand is invalid or token creation failed
-		if (token_created == 0)
-			return (0); // Malloc fail during token creation
-	}
-	return (1); // No redirection found or operand is valid
+	op_len = create_redirection_token(data, i, type, op);
+	free(op);
+	if (!op_len)
+		return (0); // Malloc fail during token creation
+	if (!check_operand(data, i, j, data->tok.tok->lexeme))
+		return (-1); // The operand is invalid
+	return (1); // Operand is valid
 }
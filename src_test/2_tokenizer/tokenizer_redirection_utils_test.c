@@ -0,0 +1,116 @@
+/**
+This file contains functions to recognize redirection operators in the input
+string and to identify redirection tokens.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	get_redirection_op(const char *s, t_token_type *type);
+int	is_redir_token(t_token_type type);
+
+/**
+Used in get_input_op() and get_output_op().
+
+Sets the token type of a recognized redirection operator.
+
+ @param type 	Pointer to the token type to be set.
+ @param value 	The token type of the recognized operator.
+ @param len 	The length of the recognized operator.
+
+ @return	The length of the recognized operator.
+*/
+static int	set_op(t_token_type *type, t_token_type value, int len)
+{
+	*type = value;
+	return (len);
+}
+
+/**
+Used in get_redirection_op().
+
+Recognizes the redirection operators starting with `<`:
+`<<<`, `<<`, `<>`, `<&` and `<`.
+
+ @param s 		The input string, starting at the operator.
+ @param type 	Pointer to the token type to be set.
+
+ @return	The length of the operator.
+*/
+static int	get_input_op(const char *s, t_token_type *type)
+{
+	if (s[1] == '<' && s[2] == '<')
+		return (set_op(type, HERESTRING, 3));
+	if (s[1] == '<')
+		return (set_op(type, HEREDOC, 2));
+	if (s[1] == '>')
+		return (set_op(type, REDIR_RW, 2));
+	if (s[1] == '&')
+		return (set_op(type, DUP_IN, 2));
+	return (set_op(type, REDIR_IN, 1));
+}
+
+/**
+Used in get_redirection_op().
+
+Recognizes the redirection operators starting with `>` or `&`:
+`>>`, `>&`, `>|`, `>`, `&>>` and `&>`.
+
+ @param s 		The input string, starting at the operator.
+ @param type 	Pointer to the token type to be set.
+
+ @return	The length of the operator.
+			`0` if `s` does not start with one of the operators above.
+*/
+static int	get_output_op(const char *s, t_token_type *type)
+{
+	if (ft_strncmp(s, "&>>", 3) == 0)
+		return (set_op(type, ALL_APPEND, 3));
+	if (ft_strncmp(s, "&>", 2) == 0)
+		return (set_op(type, ALL_OUT, 2));
+	if (s[0] != '>')
+		return (0);
+	if (s[1] == '>')
+		return (set_op(type, APPEND_OUT, 2));
+	if (s[1] == '&')
+		return (set_op(type, DUP_OUT, 2));
+	if (s[1] == '|')
+		return (set_op(type, REDIR_OUT, 2));
+	return (set_op(type, REDIR_OUT, 1));
+}
+
+/**
+Checks if the input string starts with a redirection operator (without a
+leading fd number) and sets the corresponding token type. A `<` or `>`
+directly followed by `(` is no operator but starts a process substitution
+(e.g. `<(ls)`), which is part of a word.
+
+ @param s 		The input string, starting at the potential operator.
+ @param type 	Pointer to the token type to be set.
+
+ @return	The length of the operator.
+			`0` if `s` does not start with a redirection operator.
+*/
+int	get_redirection_op(const char *s, t_token_type *type)
+{
+	if ((s[0] == '<' || s[0] == '>') && s[1] == '(')
+		return (0);
+	if (s[0] == '<')
+		return (get_input_op(s, type));
+	return (get_output_op(s, type));
+}
+
+/**
+Checks if a token type is a redirection operator, which is followed by its
+operand (file, fd number or heredoc delimiter).
+
+ @param type 	The token type to check.
+
+ @return	`1` if the token type is a redirection.
+			`0` otherwise.
+*/
+int	is_redir_token(t_token_type type)
+{
+	return (type != PIPE && type != SEPARATOR && type != OTHER);
+}
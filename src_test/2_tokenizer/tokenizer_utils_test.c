@@ -1,55 +1,148 @@
-// This source file contains a function to identify token delimiters.
+// This source file contains functions to find token boundaries and to add
+// tokens to the token list.
 
 #include "minishell.h"
 
 // IN FILE:
 
-int	is_delimiter(t_data *data, const char c);
+int		skip_word(const char *input, int i);
+void	add_token(t_data *data);
+int		is_command_start(t_data *data);
+void	number_tokens(t_list *tokens);
 
-/*
-Used in is_delimiter().
+/**
+Used in skip_word().
+
+Skips a group which may contain whitespace and operators, up to its closing
+character: a `$(...)` or `${...}` group, e.g. an arithmetic expansion or a
+command substitution, a `<(...)` or `>(...)` process substitution or a
+double-quoted string. Groups nested within it are
+skipped recursively (e.g. a `$(...)` within `"..."` may contain double
+quotes itself), as are single-quoted parts of a `$(...)` / `${...}` group.
 
-Checks if a character in the input string is a quotation mark and sets
-the quote state.
+ @param input 	The input string.
+ @param i 		The index of the group's `$`, `<`, `>` or `"` (or of a nested
+				`(` or `{`).
 
-If no quote is currently set in the 'quote' member of the data structure and
-the input character is a single (') or double (") quotation mark, it sets the
-'quote' member to that character.
-If the input character matches the currently set quotation mark, it unsets
-the 'quote' member.
+ @return	The index after the group (the end of the input if it is not
+			closed).
 */
-static void	is_quotation(t_data *data, const char c)
+static int	skip_group(const char *input, int i)
 {
-	if (!data->tok.quote)
+	char	close;
+
+	i += (input[i] == '$' || input[i] == '<' || input[i] == '>');
+	close = input[i++];
+	if (close == '(')
+		close = ')';
+	else if (close == '{')
+		close = '}';
+	while (input[i] && input[i] != close)
 	{
-		if (c == '\'' || c == '\"')
-			data->tok.quote = c;
+		if (input[i] == '\'' && close != '\"'
+			&& ft_strchr(input + i + 1, '\''))
+			i = ft_strchr(input + i + 1, '\'') - input + 1;
+		else if ((input[i] == '$' && (input[i + 1] == '('
+					|| input[i + 1] == '{')) || (input[i] == '\"'
+				&& close != '\"') || (input[i] == '(' && close == ')')
+			|| (input[i] == '{' && close == '}'))
+			i = skip_group(input, i);
+		else
+			i++;
 	}
-	else if (c == data->tok.quote)
-		data->tok.quote = '\0';
+	return (i + (input[i] != '\0'));
 }
 
 /**
-Checks if a character is a delimiter during tokenization.
+Finds the end of the word starting at index i in the input string, i.e. the
+first delimiter (whitespace, `<`, `>`, `|`, `;`, `\n` or `\0`) which is not
+within a quotation, a `` `...` `` command substitution or a `$(...)` /
+`${...}` group (see skip_group()). A `<` or `>` directly followed by `(`
+starts a process substitution, e.g. `<(ls)`, which is skipped as a group
+as well.
+
+Instead of checking every character, the input is scanned block-wise with
+ft_strcspn() up to the next delimiter, quotation mark, backtick or `$`. A
+single-quoted part or a backtick group is then skipped as a whole by
+searching for its closing character with ft_strchr(); a double-quoted part
+is skipped like a `$(...)` group, as it may contain those. An unclosed
+quotation extends to the end of the input.
+
+ @param input 	The input string.
+ @param i 		The index of the word's first character.
+
+ @return	The index of the delimiter ending the word.
+*/
+int	skip_word(const char *input, int i)
+{
+	char	*closing_quote;
 
-The function first checks if the character is a quotation mark by calling
-is_quotation(), which sets or unsets the quote state in the provided `t_data`
-struct. If a quote is open, delimiters are ignored (as part of quotation).
+	while (1)
+	{
+		i += ft_strcspn(input + i, " \t\n\v\f\r<>|;\'\"`$");
+		if (((input[i] == '$' || input[i] == '<' || input[i] == '>')
+				&& input[i + 1] == '(') || (input[i] == '$'
+				&& input[i + 1] == '{') || input[i] == '\"')
+			i = skip_group(input, i);
+		else if (input[i] == '$')
+			i++;
+		else if (input[i] != '\'' && input[i] != '`')
+			return (i);
+		else
+		{
+			closing_quote = ft_strchr(input + i + 1, input[i]);
+			if (!closing_quote)
+				return (i + ft_strlen(input + i));
+			i = closing_quote - input + 1;
+		}
+	}
+}
+
+/**
+Appends the token in `data->tok.new_node` to the token list. The last node of
+the list is kept in `data->tok.tok_last`, so appending does not need to walk
+the whole list (which made tokenizing quadratic in the number of tokens).
 
  @param data 	A pointer to the `t_data` structure.
- @param c 		The character to check.
+*/
+void	add_token(t_data *data)
+{
+	if (!data->tok.tok_lst)
+		data->tok.tok_lst = data->tok.new_node;
+	else
+		data->tok.tok_last->next = data->tok.new_node;
+	data->tok.tok_last = data->tok.new_node;
+}
+
+/**
+Checks if the next token starts a new command, i.e. if the token list is
+empty or ends with a SEPARATOR (`;` or a newline).
 
- @return	`1` if the character is a delimiter and not within a quotation.
-			`0` otherwise.
+ @param data 	A pointer to the `t_data` structure.
+
+ @return	`1` if a new command starts, `0` otherwise.
 */
-int	is_delimiter(t_data *data, const char c)
+int	is_command_start(t_data *data)
 {
-	is_quotation(data, c);
-	if (!data->tok.quote) // if not within quote
+	if (!data->tok.tok_lst)
+		return (1);
+	return (((t_token *)data->tok.tok_last->content)->type == SEPARATOR);
+}
+
+/**
+Sets the position of each token in a list to its index in the list, e.g.
+after a list was split into separate commands.
+
+ @param tokens 	The token list.
+*/
+void	number_tokens(t_list *tokens)
+{
+	int	position;
+
+	position = 0;
+	while (tokens)
 	{
-		if (is_whitespace(c) || c == '>' || c == '<' || c == '|' || c == '\n'
-			|| c == '\0')
-			return (1);
+		((t_token *)tokens->content)->position = position++;
+		tokens = tokens->next;
 	}
-	return (0);
 }
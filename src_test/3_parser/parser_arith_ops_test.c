@@ -0,0 +1,179 @@
+/**
+This file contains the operators of arithmetic expressions (see
+parser_arith_eval.c): recognizing binary and assignment operators and
+applying them to their operands.
+
+Like in bash, values are `long` integers and overflow wraps around.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int		arith_binary_op(t_arith *a, const char **op);
+int		arith_assign_op(t_arith *a, const char **op);
+long	arith_apply(t_arith *a, const char *op, long x, long y);
+
+/**
+Checks if a binary operator follows at the current position of the
+expression (after whitespace), and returns its precedence: the higher, the
+tighter it binds, e.g. `*` before `+`. The operator is not consumed.
+
+ @param a 	The state of the evaluation.
+ @param op 	Set to the operator.
+
+ @return	The precedence, or `0` if no binary operator follows.
+*/
+int	arith_binary_op(t_arith *a, const char **op)
+{
+	static const char	*ops[] = {"**", "<<", ">>", "<=", ">=", "==", "!=",
+		"&&", "||", "*", "/", "%", "+", "-", "<", ">", "&", "^", "|", NULL};
+	static const int	precedence[] = {11, 8, 8, 7, 7, 6, 6, 2, 1, 10, 10,
+		10, 9, 9, 7, 7, 5, 4, 3};
+	int					i;
+
+	arith_skip_space(a);
+	i = 0;
+	while (ops[i])
+	{
+		if (!ft_strncmp(a->expr + a->pos, ops[i], ft_strlen(ops[i])))
+		{
+			*op = ops[i];
+			return (precedence[i]);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+Checks if an assignment operator follows at the current position of the
+expression (after whitespace): `=` or a compound one like `+=`. The operator
+is not consumed.
+
+ @param a 	The state of the evaluation.
+ @param op 	Set to the binary operator of a compound assignment (e.g. `+`
+			for `+=`), an empty string for `=`.
+
+ @return	The length of the assignment operator, or `0` if none follows.
+*/
+int	arith_assign_op(t_arith *a, const char **op)
+{
+	static const char	*ops[] = {"<<", ">>", "+", "-", "*", "/", "%", "&",
+		"^", "|", "", NULL};
+	const char			*s;
+	int					len;
+	int					i;
+
+	arith_skip_space(a);
+	s = a->expr + a->pos;
+	i = 0;
+	while (ops[i])
+	{
+		len = ft_strlen(ops[i]);
+		if (!ft_strncmp(s, ops[i], len) && s[len] == '=' && s[len + 1] != '=')
+		{
+			*op = ops[i];
+			return (len + 1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+Used in arith_apply().
+
+Raises `x` to the power of `y` by repeated squaring.
+*/
+static long	power(t_arith *a, long x, long y)
+{
+	unsigned long	base;
+	unsigned long	result;
+
+	if (y < 0)
+		return (arith_error(a, ERR_ARITH_EXP, a->tok));
+	base = x;
+	result = 1;
+	while (y > 0)
+	{
+		if (y & 1)
+			result *= base;
+		base *= base;
+		y >>= 1;
+	}
+	return ((long)result);
+}
+
+/**
+Used in arith_apply().
+
+Applies the shift, comparison, logical and bitwise operators, which can't
+fail. Comparisons and logical operators result in `1` (true) or `0`.
+*/
+static long	apply_logic(const char *op, long x, long y)
+{
+	if (!ft_strcmp(op, "<<"))
+		return ((long)((unsigned long)x << (y & 63)));
+	if (!ft_strcmp(op, ">>"))
+		return (x >> (y & 63));
+	if (!ft_strcmp(op, "<="))
+		return (x <= y);
+	if (!ft_strcmp(op, ">="))
+		return (x >= y);
+	if (!ft_strcmp(op, "=="))
+		return (x == y);
+	if (!ft_strcmp(op, "!="))
+		return (x != y);
+	if (!ft_strcmp(op, "&&"))
+		return (x && y);
+	if (!ft_strcmp(op, "||"))
+		return (x || y);
+	if (op[0] == '<')
+		return (x < y);
+	if (op[0] == '>')
+		return (x > y);
+	if (op[0] == '&')
+		return (x & y);
+	if (op[0] == '^')
+		return (x ^ y);
+	return (x | y);
+}
+
+/**
+Applies a binary operator (see arith_binary_op()) to its operands.
+
+ @param a 	The state of the evaluation.
+ @param op 	The operator.
+ @param x 	The left operand.
+ @param y 	The right operand.
+
+ @return	The result; `0` on division by 0 (reported as an error, unless
+			the expression is only parsed).
+*/
+long	arith_apply(t_arith *a, const char *op, long x, long y)
+{
+	if ((op[0] == '/' || op[0] == '%') && y == 0)
+	{
+		if (!a->noeval)
+			arith_error(a, ERR_ARITH_DIV_0, a->tok);
+		return (0);
+	}
+	if (op[0] == '/' && y == -1)
+		return ((long)(0UL - (unsigned long)x));
+	if (op[0] == '%' && y == -1)
+		return (0);
+	if (op[0] == '/')
+		return (x / y);
+	if (op[0] == '%')
+		return (x % y);
+	if (!ft_strcmp(op, "**"))
+		return (power(a, x, y));
+	if (op[0] == '*')
+		return ((long)((unsigned long)x * (unsigned long)y));
+	if (op[0] == '+')
+		return ((long)((unsigned long)x + (unsigned long)y));
+	if (op[0] == '-')
+		return ((long)((unsigned long)x - (unsigned long)y));
+	return (apply_logic(op, x, y));
+}
@@ -0,0 +1,155 @@
+/**
+This file contains functions to parse the compound commands of a command list
+(see parser_compound.c): `if`, `while` / `until` and `for`. Their return
+values are the same as those of parse_list().
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	parse_if(t_data *data, t_list **cur, t_node **node);
+int	parse_loop(t_data *data, t_list **cur, t_node **node);
+int	parse_for(t_data *data, t_list **cur, t_node **node);
+
+/**
+Parses `if` cond `then` body [`elif` ...] [`else` other] `fi`, starting at
+the `if` (or the `elif`, which is parsed as an `if` nested in the `else`
+part, and consumes the `fi`).
+*/
+int	parse_if(t_data *data, t_list **cur, t_node **node)
+{
+	int	ret;
+
+	*node = new_node(NODE_IF);
+	if (!*node)
+		return (0);
+	*cur = (*cur)->next;
+	ret = parse_list(data, cur, &(*node)->cond);
+	if (ret > 0)
+		ret = expect_word(data, cur, "then");
+	if (ret > 0)
+		ret = parse_list(data, cur, &(*node)->body);
+	if (ret <= 0)
+		return (ret);
+	if (is_reserved_word(*cur, "elif"))
+		return (parse_if(data, cur, &(*node)->other));
+	if (is_reserved_word(*cur, "else"))
+	{
+		*cur = (*cur)->next;
+		ret = parse_list(data, cur, &(*node)->other);
+		if (ret <= 0)
+			return (ret);
+	}
+	return (expect_word(data, cur, "fi"));
+}
+
+/**
+Parses `while` cond `do` body `done` and `until` cond `do` body `done`,
+starting at the `while` or `until`.
+*/
+int	parse_loop(t_data *data, t_list **cur, t_node **node)
+{
+	int	ret;
+
+	if (is_reserved_word(*cur, "while"))
+		*node = new_node(NODE_WHILE);
+	else
+		*node = new_node(NODE_UNTIL);
+	if (!*node)
+		return (0);
+	*cur = (*cur)->next;
+	ret = parse_list(data, cur, &(*node)->cond);
+	if (ret > 0)
+		ret = expect_word(data, cur, "do");
+	if (ret > 0)
+		ret = parse_list(data, cur, &(*node)->body);
+	if (ret > 0)
+		ret = expect_word(data, cur, "done");
+	return (ret);
+}
+
+/**
+Used in parse_for().
+
+Checks if the loop variable's name is a valid identifier: letters, digits
+and underscores, not starting with a digit, and not quoted.
+*/
+static int	is_valid_name(t_list *cur)
+{
+	t_token	*token;
+	int		i;
+
+	token = (t_token *)cur->content;
+	if (token->type != OTHER || ft_isdigit(token->lexeme[0]))
+		return (0);
+	i = 0;
+	while (ft_isalnum(token->lexeme[i]) || token->lexeme[i] == '_')
+		i++;
+	return (i > 0 && token->lexeme[i] == '\0');
+}
+
+/**
+Used in parse_for().
+
+Parses the optional `in` word... part after the name of the loop variable:
+The words up to the next separator are copied into the node, as they are
+only expanded when the loop starts. Without `in` the loop has no words, as
+minishell has no positional parameters. The separator is consumed.
+*/
+static int	parse_for_words(t_list **cur, t_node *node)
+{
+	t_list	*end;
+
+	if (is_reserved_word(*cur, "in"))
+	{
+		*cur = (*cur)->next;
+		end = *cur;
+		while (end && ((t_token *)end->content)->type != SEPARATOR)
+			end = end->next;
+		node->tokens = copy_tokens(*cur, end);
+		if (!node->tokens && *cur != end)
+		{
+			print_err_msg(ERR_MALLOC);
+			return (0);
+		}
+		*cur = end;
+	}
+	if (!*cur)
+		return (-1);
+	if (((t_token *)(*cur)->content)->type == SEPARATOR)
+		*cur = (*cur)->next;
+	return (1);
+}
+
+/**
+Parses `for` name [`in` words] `do` body `done`, starting at the `for`.
+*/
+int	parse_for(t_data *data, t_list **cur, t_node **node)
+{
+	int	ret;
+
+	*node = new_node(NODE_FOR);
+	if (!*node)
+		return (0);
+	*cur = (*cur)->next;
+	if (!*cur)
+		return (-1);
+	if (!is_valid_name(*cur))
+		return (syntax_error(data, *cur));
+	(*node)->name = ft_strdup(((t_token *)(*cur)->content)->lexeme);
+	if (!(*node)->name)
+	{
+		print_err_msg(ERR_MALLOC);
+		return (0);
+	}
+	*cur = (*cur)->next;
+	ret = parse_for_words(cur, *node);
+	if (ret > 0)
+		ret = expect_word(data, cur, "do");
+	if (ret > 0)
+		ret = parse_list(data, cur, &(*node)->body);
+	if (ret > 0)
+		ret = expect_word(data, cur, "done");
+	return (ret);
+}
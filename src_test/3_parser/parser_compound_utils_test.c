@@ -0,0 +1,131 @@
+/**
+This file contains utility functions for parsing command lists with control
+flow (see parser_compound.c): creating and freeing the nodes of a list,
+recognizing reserved words and reporting syntax errors.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+t_node	*new_node(t_node_type type);
+void	free_nodes(t_node *node);
+int		is_reserved_word(t_list *cur, const char *word);
+int		is_list_end(t_list *cur);
+int		syntax_error(t_data *data, t_list *cur);
+
+/**
+Creates a new node of a command list, with all members set to `NULL`.
+
+ @param type 	The kind of command.
+
+ @return	The new node, or `NULL` on malloc failure (which also prints an
+			error message).
+*/
+t_node	*new_node(t_node_type type)
+{
+	t_node	*node;
+
+	node = ft_calloc(1, sizeof(t_node));
+	if (!node)
+	{
+		print_err_msg(ERR_MALLOC);
+		return (NULL);
+	}
+	node->type = type;
+	return (node);
+}
+
+/**
+Frees a command list, including all lists nested in its commands.
+
+ @param node 	The first node of the list (may be `NULL`).
+*/
+void	free_nodes(t_node *node)
+{
+	t_node	*next;
+
+	while (node)
+	{
+		next = node->next;
+		ft_lstclear(&node->tokens, del_token);
+		free(node->name);
+		ft_lstclear(&node->heredocs, free);
+		free_nodes(node->cond);
+		free_nodes(node->body);
+		free_nodes(node->other);
+		free(node);
+		node = next;
+	}
+}
+
+/**
+Checks if a token is a certain reserved word, i.e. an OTHER token with
+exactly this lexeme (so a quoted `"if"` is not a reserved word).
+
+ @param cur 	The node of the token (may be `NULL`).
+ @param word 	The reserved word.
+
+ @return	`1` if the token is the reserved word, `0` otherwise.
+*/
+int	is_reserved_word(t_list *cur, const char *word)
+{
+	t_token	*token;
+
+	if (!cur)
+		return (0);
+	token = (t_token *)cur->content;
+	return (token->type == OTHER && ft_strcmp(token->lexeme, word) == 0);
+}
+
+/**
+Checks if a command list ends at a token: at the end of the tokens or at one
+of the reserved words which close a list (`then`, `elif`, `else`, `fi`, `do`
+and `done`).
+
+ @param cur 	The node of the token (may be `NULL`).
+
+ @return	`1` if the list ends, `0` otherwise.
+*/
+int	is_list_end(t_list *cur)
+{
+	static const char	*words[] = {"then", "elif", "else", "fi", "do",
+		"done", NULL};
+	int					i;
+
+	if (!cur)
+		return (1);
+	i = 0;
+	while (words[i])
+	{
+		if (is_reserved_word(cur, words[i++]))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+Prints an error message for a token at a place where it is not allowed and
+sets the exit status, like other syntax errors.
+
+ @param data 	Pointer to the data struct.
+ @param cur 	The node of the unexpected token.
+
+ @return	`0`, so it can be returned by the parsing functions.
+*/
+int	syntax_error(t_data *data, t_list *cur)
+{
+	char	*lexeme;
+
+	lexeme = ((t_token *)cur->content)->lexeme;
+	if (ft_strcmp(lexeme, "\n") == 0)
+		lexeme = "newline";
+	ft_putstr_fd(ERR_COLOR, STDERR_FILENO);
+	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
+	ft_putstr_fd(ERR_SYNTAX_NEAR, STDERR_FILENO);
+	ft_putstr_fd(lexeme, STDERR_FILENO);
+	ft_putstr_fd("'\n", STDERR_FILENO);
+	ft_putstr_fd(RESET, STDERR_FILENO);
+	data->exit_status = ENOENT;
+	return (0);
+}
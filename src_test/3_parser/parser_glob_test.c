@@ -0,0 +1,188 @@
+/**
+This file contains functions for pathname expansion: a word with an unquoted
+`*`, `?` or bracket expression is a pattern, which is replaced with the names
+of the existing files matching it, sorted alphabetically (see
+parser_glob_dir.c). If no file matches, the word is kept as it is.
+
+The word is split into its components at each unquoted `/`, and every
+component is compiled once (see pattern_compile()), however many directory
+entries it is matched against.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	expand_glob(t_data *data);
+
+/**
+Used in expand_glob().
+
+Splits a word into its components at each unquoted `/` (see param_split())
+and compiles each of them. A leading `/` results in an empty first
+component, a trailing `/` in an empty last one.
+
+ @param g 		The pathname expansion, `pats`, `count` and `magic` are set.
+ @param word 	The word, with quotes.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	compile_glob(t_glob *g, const char *word)
+{
+	char	*comp;
+	size_t	len;
+	size_t	i;
+
+	g->count = 1;
+	len = param_split(word, '/');
+	while (word[len] && ++g->count)
+		len += 1 + param_split(word + len + 1, '/');
+	g->pats = ft_calloc(g->count, sizeof(t_pattern *));
+	i = 0;
+	while (g->pats && i < g->count)
+	{
+		len = param_split(word, '/');
+		comp = ft_strndup(word, len);
+		if (comp)
+			g->pats[i] = pattern_compile(comp);
+		free(comp);
+		if (!g->pats[i])
+			return (0);
+		g->magic = (g->pats[i++]->magic || g->magic);
+		word += len + (word[len] == '/');
+	}
+	return (g->pats != NULL);
+}
+
+/**
+Used in sort_matches().
+
+Merges two lists of matches, which are sorted alphabetically, into one.
+*/
+static t_list	*merge_matches(t_list *left, t_list *right)
+{
+	t_list	head;
+	t_list	*tail;
+
+	tail = &head;
+	while (left && right)
+	{
+		if (ft_strcmp(((t_token *)left->content)->lexeme,
+				((t_token *)right->content)->lexeme) <= 0)
+		{
+			tail->next = left;
+			left = left->next;
+		}
+		else
+		{
+			tail->next = right;
+			right = right->next;
+		}
+		tail = tail->next;
+	}
+	tail->next = left;
+	if (!left)
+		tail->next = right;
+	return (head.next);
+}
+
+/**
+Used in splice_matches().
+
+Sorts the first `len` nodes of a list of matches alphabetically with a merge
+sort, which takes O(n log n) comparisons.
+*/
+static t_list	*sort_matches(t_list *list, size_t len)
+{
+	t_list	*last;
+	t_list	*right;
+	size_t	i;
+
+	if (len < 2)
+	{
+		list->next = NULL;
+		return (list);
+	}
+	last = list;
+	i = 1;
+	while (i++ < len / 2)
+		last = last->next;
+	right = last->next;
+	last->next = NULL;
+	return (merge_matches(sort_matches(list, len / 2),
+			sort_matches(right, len - len / 2)));
+}
+
+/**
+Used in expand_glob().
+
+Replaces the token in `data->tok.curr_node` with the sorted matches: the
+first one takes its place, the others are inserted after it.
+`data->tok.curr_node` is moved to the last match, so they are not expanded
+again.
+*/
+static void	splice_matches(t_data *data, t_glob *g)
+{
+	t_list	*node;
+	t_list	*first;
+	t_list	*last;
+
+	first = sort_matches(g->matches, g->found);
+	g->matches = NULL;
+	node = data->tok.curr_node;
+	del_token(node->content);
+	node->content = first->content;
+	if (first->next)
+	{
+		last = ft_lstlast(first);
+		last->next = node->next;
+		node->next = first->next;
+		if (data->tok.tok_last == node)
+			data->tok.tok_last = last;
+		data->tok.curr_node = last;
+	}
+	free(first);
+}
+
+/**
+Used in expand_token().
+
+Expands the token in `data->tok.curr_node` if it is a pattern (after the
+other expansions, with its quotes): it is replaced with the sorted paths of
+the matching files (see glob_dir()), which need no quote removal. Words
+without `*`, `?` or `[` are not even compiled.
+
+ @param data 	Pointer to the data struct.
+
+ @return	`1` if the token was replaced with the matches.
+			`0` if it is no pattern or no file matches (it is kept).
+			`-1` on malloc failure.
+*/
+int	expand_glob(t_data *data)
+{
+	t_glob	g;
+	char	*word;
+	size_t	i;
+	int		ret;
+
+	word = ((t_token *)data->tok.curr_node->content)->lexeme;
+	if (!word[ft_strcspn(word, "*?[")])
+		return (0);
+	ft_bzero(&g, sizeof(t_glob));
+	ret = (compile_glob(&g, word) && ft_sb_reserve(&g.path, 0));
+	if (ret && g.magic)
+		glob_dir(&g, 0);
+	if (!ret || g.error)
+		ret = -1;
+	else if (!g.found)
+		ret = 0;
+	else
+		splice_matches(data, &g);
+	i = 0;
+	while (g.pats && i < g.count)
+		pattern_free(g.pats[i++]);
+	free(g.pats);
+	ft_sb_free(&g.path);
+	ft_lstclear(&g.matches, del_token);
+	return (ret);
+}
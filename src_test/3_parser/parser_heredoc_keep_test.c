@@ -0,0 +1,125 @@
+/**
+This file contains the keeping of the heredoc bodies of a command list (see
+parser_program.c): Once the list is complete, the lines read ahead (see
+parser_heredoc_collect.c) are stored unexpanded with the command they belong
+to. On every execution of the command they are queued again, so
+process_heredocs() expands them anew, e.g. in each iteration of a loop.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	keep_heredocs(t_data *data, t_node *node);
+int	load_heredocs(t_data *data, t_node *node);
+
+/**
+Used in keep_heredocs().
+
+Moves the lines of a heredoc body from `data->heredoc_lines` to the lines of a
+command, up to the line with the delimiter. If the input ended before it, a
+warning is printed and the delimiter is added, so the body still ends when it
+is read again.
+
+ @param data 		Pointer to the data struct.
+ @param tail 		Pointer to the `next` pointer of the last line of the
+ 					command, moved along.
+ @param delimiter 	The delimiter, with paired quotes removed.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	take_body(t_data *data, t_list ***tail, char *delimiter)
+{
+	t_list	*node;
+	char	*line;
+
+	while (data->heredoc_lines)
+	{
+		node = data->heredoc_lines;
+		data->heredoc_lines = node->next;
+		node->next = NULL;
+		**tail = node;
+		*tail = &node->next;
+		if (ft_strcmp(node->content, delimiter) == 0)
+			return (1);
+	}
+	handle_eot_heredoc(delimiter);
+	line = ft_strdup(delimiter);
+	if (line)
+		node = ft_lstnew(line);
+	if (!line || !node)
+	{
+		free(line);
+		return (0);
+	}
+	**tail = node;
+	*tail = &node->next;
+	return (1);
+}
+
+/**
+Used in prepare_heredocs().
+
+Stores the bodies of the heredocs of a command in `node->heredocs`, in the
+order they appear. Also counts its pipes, so `data->pipe_nr` ends up above
+the number of any heredoc file of the list (see delete_heredocs()).
+
+ @param data 	Pointer to the data struct, with the bodies of all heredocs
+ 				of the list in `data->heredoc_lines`.
+ @param node 	The command (`NODE_CMD`).
+
+ @return	`1` on success, `0` on malloc failure (an error message was
+			printed).
+*/
+int	keep_heredocs(t_data *data, t_node *node)
+{
+	t_list	**tail;
+	t_list	*cur;
+	char	*delim;
+	int		ret;
+
+	tail = &node->heredocs;
+	cur = node->tokens;
+	ret = 1;
+	while (cur && ret)
+	{
+		count_pipes(data, cur->content);
+		if (((t_token *)cur->content)->type == HEREDOC && cur->next)
+		{
+			delim = trim_paired_quotes(((t_token *)cur->next->content)->lexeme);
+			ret = (delim && take_body(data, &tail, delim));
+			free(delim);
+		}
+		cur = cur->next;
+	}
+	data->pipe_nr++;
+	if (!ret)
+		print_err_msg(ERR_MALLOC);
+	return (ret);
+}
+
+/**
+Used in load_heredocs().
+
+Copies a line of a heredoc body, for ft_lstmap().
+*/
+static void	*copy_line(void *line)
+{
+	return (ft_strdup(line));
+}
+
+/**
+Used in run_command().
+
+Queues a copy of the heredoc bodies of a command in `data->heredoc_lines`,
+where process_heredocs() reads them from instead of the input.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+int	load_heredocs(t_data *data, t_node *node)
+{
+	if (!node->heredocs)
+		return (1);
+	data->heredoc_lines = ft_lstmap(node->heredocs, copy_line, free);
+	return (data->heredoc_lines != NULL);
+}
@@ -21,19 +21,17 @@ Creates a heredoc filename.
 */
 char	*get_heredoc(t_data *data)
 {
-	char	*index;
-	char	*heredoc;
-	char	*heredoc_path;
+	t_strbuf	sb;
 
-	index = ft_itoa(data->pipe_nr);
-	if (!index)
+	ft_sb_init(&sb);
+	if (!ft_sb_adds(&sb, data->working_dir)
+		|| !ft_sb_adds(&sb, HEREDOC_PREFIX)
+		|| !ft_sb_addnbr(&sb, data->pipe_nr))
+	{
+		ft_sb_free(&sb);
 		return (NULL);
-	heredoc = ft_strjoin(HEREDOC_PREFIX, index);
-	free(index);
-	heredoc_path = ft_strjoin(data->working_dir, heredoc);
-	if (heredoc)
-		free(heredoc);
-	return (heredoc_path);
+	}
+	return (ft_sb_steal(&sb));
 }
 
 /**
@@ -50,7 +48,7 @@ int	get_heredoc_fd(t_data *data)
 	heredoc = get_heredoc(data);
 	if (!heredoc)
 		return (-1);
-	fd = open(heredoc, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	fd = open(heredoc, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
 	free(heredoc);
 	return (fd);
 }
@@ -0,0 +1,127 @@
+/**
+This file contains the operators of parameter expansions (see
+parser_param.c):
+ - `${NAME-word}` / `${NAME:-word}`: `word` if unset (or empty),
+ - `${NAME=word}` / `${NAME:=word}`: the same, also assigning `word`,
+ - `${NAME+word}` / `${NAME:+word}`: `word` if set (and not empty),
+ - `${NAME#pat}` / `${NAME##pat}`: removing the shortest / longest beginning
+   matching the pattern, `${NAME%pat}` / `${NAME%%pat}` the same for the end,
+ - `${NAME/pat/rep}` and its forms: replacing matches (see
+   parser_param_replace.c),
+ - `${NAME:offset}` / `${NAME:offset:length}`: a substring.
+The patterns are compiled once per expansion (see parser_pattern.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	param_default(t_param *p);
+int	param_trim(t_param *p);
+int	param_substring(t_param *p);
+
+/**
+Applies `-`, `=` or `+`, optionally preceded by `:` (then an empty value is
+treated like an unset one). The word is only expanded if it is used. As
+minishell has no shell variables, `=` assigns it in the environment.
+
+ @return	See expand_parameter().
+*/
+int	param_default(t_param *p)
+{
+	char	*word;
+	char	op;
+	bool	set;
+	int		ret;
+
+	set = (p->is_set && (p->op[0] != ':' || *p->value));
+	op = p->op[p->op[0] == ':'];
+	if ((op == '+') != set)
+	{
+		if (op == '+')
+			p->result = ft_strdup("");
+		else
+			p->result = ft_strdup(p->value);
+		return (p->result != NULL);
+	}
+	word = p->op + (p->op[0] == ':') + 1;
+	ret = param_word(p, word, ft_strlen(word), &p->result);
+	if (ret <= 0 || op != '=')
+		return (ret);
+	if (ft_isdigit(p->name[0]) || !ft_strcmp(p->name, "?"))
+		return (param_error(p, ERR_PARAM_ASSIGN));
+	word = trim_paired_quotes(p->result);
+	ret = (word && set_env_var(p->data, p->name, word));
+	free(word);
+	return (ret);
+}
+
+/**
+Removes the shortest or longest (if the operator is doubled) beginning
+(`#`) or end (`%`) of the value which matches the pattern.
+
+ @return	See expand_parameter().
+*/
+int	param_trim(t_param *p)
+{
+	t_pattern	*pat;
+	ssize_t		n;
+	size_t		len;
+	int			longest;
+	int			ret;
+
+	longest = (p->op[1] == p->op[0]);
+	ret = param_pattern(p, p->op + 1 + longest,
+			ft_strlen(p->op + 1 + longest), &pat);
+	if (ret <= 0)
+		return (ret);
+	len = ft_strlen(p->value);
+	if (p->op[0] == '#')
+		n = pattern_match_prefix(pat, p->value, len, longest);
+	else
+		n = pattern_match_suffix(pat, p->value, len, longest);
+	pattern_free(pat);
+	if (n < 0)
+		n = 0;
+	if (p->op[0] == '#')
+		p->result = ft_strdup(p->value + n);
+	else
+		p->result = ft_strndup(p->value, len - n);
+	return (p->result != NULL);
+}
+
+/**
+Takes the substring starting at `offset` with (at most) `length`
+characters, both arithmetic expressions. A negative offset counts from the
+end of the value, a negative length is the distance of the substring's end
+from the end of the value. An offset out of range results in an empty
+string.
+
+ @return	See expand_parameter().
+*/
+int	param_substring(t_param *p)
+{
+	size_t	end;
+	long	off;
+	long	len;
+	long	vlen;
+	int		ret;
+
+	end = 1 + param_split(p->op + 1, ':');
+	vlen = ft_strlen(p->value);
+	len = vlen;
+	ret = param_arith(p, p->op + 1, end - 1, &off);
+	if (ret > 0 && p->op[end])
+		ret = param_arith(p, p->op + end + 1, ft_strlen(p->op + end + 1), &len);
+	if (ret <= 0)
+		return (ret);
+	off += (off < 0) * vlen;
+	if (off < 0 || off > vlen)
+		len = 0;
+	else if (len < 0)
+		len = vlen + len - off;
+	if (len < 0)
+		return (param_error(p, ERR_SUBSTR_NEG));
+	p->result = ft_strndup(p->value + off * (len > 0), len);
+	return (p->result != NULL);
+}
@@ -0,0 +1,137 @@
+/**
+This file contains the replacing operators of parameter expansions (see
+parser_param_ops.c):
+ - `${NAME/pat/rep}` / `${NAME//pat/rep}`: replacing the first / every match,
+ - `${NAME/#pat/rep}` / `${NAME/%pat/rep}`: replacing a match at the
+   beginning / end of the value.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	param_replace(t_param *p);
+
+/**
+Used in replace_matches().
+
+Finds the longest match of the pattern at the beginning of `str`. Where the
+first character cannot match the first element of the pattern (unless it is
+a `*`), there is no match, without trying every length.
+
+ @return	The length of the match, `-1` if there is none.
+*/
+static ssize_t	match_at(const t_pattern *pat, const char *str, size_t len)
+{
+	if (pat->elems[0].type != PAT_STAR
+		&& !pattern_elem_match(&pat->elems[0], str[0]))
+		return (-1);
+	return (pattern_match_prefix(pat, str, len, 1));
+}
+
+/**
+Used in param_replace().
+
+Builds the result of `/` or `//`: the value with the longest match of the
+pattern at the leftmost position (or at every position, if `global`)
+replaced by `rep`. Positions where only the empty string matches are
+skipped.
+*/
+static int	replace_matches(t_param *p, t_pattern *pat, const char *rep,
+				int global)
+{
+	t_strbuf	sb;
+	size_t		len;
+	size_t		i;
+	ssize_t		n;
+	int			ok;
+
+	ft_sb_init(&sb);
+	len = ft_strlen(p->value);
+	i = 0;
+	ok = 1;
+	while (ok && i < len && global >= 0)
+	{
+		n = match_at(pat, p->value + i, len - i);
+		if (n <= 0)
+			ok = ft_sb_addc(&sb, p->value[i++]);
+		else
+			ok = ft_sb_adds(&sb, rep);
+		i += (n > 0) * n;
+		global -= (n > 0 && !global);
+	}
+	if (ok && ft_sb_adds(&sb, p->value + i))
+		p->result = ft_sb_steal(&sb);
+	ft_sb_free(&sb);
+	return (p->result != NULL);
+}
+
+/**
+Used in param_replace().
+
+Builds the result of `/#` or `/%`: the value with the longest match of the
+pattern at its beginning (`#`) or end (`%`) replaced by `rep`. Unlike with
+`/`, an empty match counts, so an empty pattern adds `rep` there.
+*/
+static int	replace_anchored(t_param *p, t_pattern *pat, const char *rep,
+				char anchor)
+{
+	char	*head;
+	size_t	len;
+	ssize_t	n;
+
+	len = ft_strlen(p->value);
+	if (anchor == '#')
+		n = pattern_match_prefix(pat, p->value, len, 1);
+	else
+		n = pattern_match_suffix(pat, p->value, len, 1);
+	if (n < 0)
+		p->result = ft_strdup(p->value);
+	else if (anchor == '#')
+		p->result = ft_strjoin(rep, p->value + n);
+	else
+	{
+		head = ft_strndup(p->value, len - n);
+		if (head)
+			p->result = ft_strjoin(head, rep);
+		free(head);
+	}
+	return (p->result != NULL);
+}
+
+/**
+Replaces the first (`/`) or every (`//`) match of the pattern within the
+value, or a match at its beginning (`/#`) or end (`/%`). The pattern ends at
+the first unquoted `/` (see param_split()); if there is none, matches are
+removed. An empty pattern leaves the value unchanged, unless it is anchored.
+
+ @return	See expand_parameter().
+*/
+int	param_replace(t_param *p)
+{
+	t_pattern	*pat;
+	char		*rep;
+	size_t		start;
+	size_t		end;
+	int			ret;
+
+	start = 1 + (p->op[1] == '/' || p->op[1] == '#' || p->op[1] == '%');
+	end = start + param_split(p->op + start, '/');
+	if (end == start && p->op[start - 1] == '/')
+	{
+		p->result = ft_strdup(p->value);
+		return (p->result != NULL);
+	}
+	rep = NULL;
+	ret = param_pattern(p, p->op + start, end - start, &pat);
+	end += (p->op[end] == '/');
+	if (ret > 0)
+		ret = param_word(p, p->op + end, ft_strlen(p->op + end), &rep);
+	if (ret > 0 && p->op[start - 1] != '/')
+		ret = replace_anchored(p, pat, rep, p->op[1]);
+	else if (ret > 0)
+		ret = replace_matches(p, pat, rep, p->op[1] == '/');
+	pattern_free(pat);
+	free(rep);
+	return (ret);
+}
@@ -0,0 +1,162 @@
+/**
+This file contains functions for parameter expansion with braces: `${NAME}`
+and its forms with an operator (see parser_param_ops.c), e.g. `${NAME:-word}`
+or `${#NAME}`. The word following an operator is expanded itself, but the
+result of the whole expansion is not expanded again.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	param_end(const char *str, int i);
+int	expand_parameter(char **str, int *i, t_data *data);
+
+/**
+Checks if a parameter expansion starts at index `i` of the string, i.e.
+`${`, and finds its end: the `}` closing it. Braces within quotations are
+skipped, nested braces have to be balanced.
+
+ @param str 	The string.
+ @param i 		The index of the `$`.
+
+ @return	The index after the closing `}`, or `0` if there is no
+			(complete) parameter expansion.
+*/
+int	param_end(const char *str, int i)
+{
+	int	depth;
+
+	if (str[i] != '$' || str[i + 1] != '{')
+		return (0);
+	i++;
+	depth = 0;
+	while (str[i])
+	{
+		if ((str[i] == '\'' || str[i] == '\"')
+			&& ft_strchr(str + i + 1, str[i]))
+			i = ft_strchr(str + i + 1, str[i]) - str;
+		else if (str[i] == '{')
+			depth++;
+		else if (str[i] == '}')
+			depth--;
+		i++;
+		if (depth == 0)
+			return (i);
+	}
+	return (0);
+}
+
+/**
+Used in expand_parameter().
+
+Splits the text between the braces into the `#` of `${#NAME}`, the name of
+the parameter and the operator following it, and looks up the value of the
+parameter.
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if there is no valid name (an error message was printed).
+*/
+static int	parse_param(t_param *p)
+{
+	char	*value;
+	int		i;
+
+	i = (p->expr[0] == '#' && p->expr[1]);
+	p->length = i;
+	if (p->expr[i] == '?')
+		i++;
+	else
+		while (ft_isalnum(p->expr[i]) || p->expr[i] == '_')
+			i++;
+	if (i == p->length || (p->length && p->expr[i]))
+		return (param_error(p, ERR_BAD_SUBST));
+	p->name = ft_substr(p->expr, p->length, i - p->length);
+	if (!p->name)
+		return (0);
+	p->op = p->expr + i;
+	p->is_set = true;
+	if (!ft_strcmp(p->name, "?"))
+		p->value = ft_itoa(p->data->exit_status);
+	else
+	{
+		value = get_env_value(p->data->envp_temp, p->name);
+		p->is_set = (value != NULL);
+		if (!value)
+			value = "";
+		p->value = ft_strdup(value);
+	}
+	return (p->value != NULL);
+}
+
+/**
+Used in expand_parameter().
+
+Applies the operator following the name to the value of the parameter.
+
+ @return	See expand_parameter().
+*/
+static int	apply_op(t_param *p)
+{
+	char	*op;
+
+	op = p->op;
+	if (p->length)
+		p->result = ft_itoa(ft_strlen(p->value));
+	else if (!*op)
+		p->result = ft_strdup(p->value);
+	else if (ft_strchr("-=+", op[0])
+		|| (op[0] == ':' && op[1] && ft_strchr("-=+", op[1])))
+		return (param_default(p));
+	else if (op[0] == ':')
+		return (param_substring(p));
+	else if (op[0] == '#' || op[0] == '%')
+		return (param_trim(p));
+	else if (op[0] == '/')
+		return (param_replace(p));
+	else
+		return (param_error(p, ERR_BAD_SUBST));
+	return (p->result != NULL);
+}
+
+/**
+Used in process_variable().
+
+Replaces the parameter expansion at index `*i` of the string (see
+param_end()) with its result.
+
+ @param str 	Pointer to the string, which is replaced by a new one.
+ @param i 		Pointer to the index of the `$`, moved to the last character
+				of the result.
+ @param data 	Pointer to the data struct.
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if the expansion is invalid (an error message was printed).
+*/
+int	expand_parameter(char **str, int *i, t_data *data)
+{
+	t_param	p;
+	int		end;
+	int		ret;
+
+	ft_bzero(&p, sizeof(t_param));
+	p.data = data;
+	end = param_end(*str, *i);
+	p.expr = ft_substr(*str, *i + 2, end - *i - 3);
+	ret = (p.expr != NULL);
+	if (ret > 0)
+		ret = parse_param(&p);
+	if (ret > 0)
+		ret = apply_op(&p);
+	if (ret > 0)
+		ret = replace_range(str, *i, end, p.result);
+	if (ret > 0)
+		*i += ft_strlen(p.result) - 1;
+	free(p.expr);
+	free(p.name);
+	free(p.value);
+	free(p.result);
+	return (ret);
+}
@@ -0,0 +1,136 @@
+/**
+This file contains utility functions for parameter expansions (see
+parser_param.c): reporting errors and expanding the words following an
+operator, as a word, a pattern or an arithmetic expression, and splitting
+them.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int		param_error(t_param *p, const char *msg);
+int		param_word(t_param *p, const char *word, size_t len, char **out);
+int		param_pattern(t_param *p, const char *word, size_t len,
+			t_pattern **pat);
+int		param_arith(t_param *p, const char *word, size_t len, long *value);
+size_t	param_split(const char *word, char sep);
+
+/**
+Prints an error message for a parameter expansion, e.g.
+`minishell: ${x!}: bad substitution`, and sets the exit status to `1`.
+
+ @param p 		The parameter expansion.
+ @param msg 	The error message.
+
+ @return	`-1`, so it can be returned for an invalid expansion.
+*/
+int	param_error(t_param *p, const char *msg)
+{
+	p->data->exit_status = 1;
+	ft_putstr_fd(ERR_COLOR, STDERR_FILENO);
+	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
+	ft_putstr_fd("${", STDERR_FILENO);
+	ft_putstr_fd(p->expr, STDERR_FILENO);
+	ft_putstr_fd("}: ", STDERR_FILENO);
+	ft_putstr_fd((char *)msg, STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	ft_putstr_fd(RESET, STDERR_FILENO);
+	return (-1);
+}
+
+/**
+Expands the variables (and nested expansions) within the word following an
+operator. Quotes are kept.
+
+ @param p 		The parameter expansion.
+ @param word 	The word.
+ @param len 	The length of the word.
+ @param out 	Set to the expanded word (to be freed by the caller).
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if a nested expansion is invalid (an error message was
+			printed).
+*/
+int	param_word(t_param *p, const char *word, size_t len, char **out)
+{
+	int	ret;
+
+	*out = ft_strndup(word, len);
+	if (!*out)
+		return (0);
+	ret = expand_nested(out, p->data);
+	if (ret <= 0)
+	{
+		free(*out);
+		*out = NULL;
+	}
+	return (ret);
+}
+
+/**
+Expands and compiles the pattern following an operator, e.g. of
+`${NAME#pattern}`.
+
+ @param pat 	Set to the compiled pattern (to be freed with pattern_free()).
+
+ @return	See param_word().
+*/
+int	param_pattern(t_param *p, const char *word, size_t len, t_pattern **pat)
+{
+	char	*expanded;
+	int		ret;
+
+	*pat = NULL;
+	ret = param_word(p, word, len, &expanded);
+	if (ret <= 0)
+		return (ret);
+	*pat = pattern_compile(expanded);
+	free(expanded);
+	return (*pat != NULL);
+}
+
+/**
+Expands and evaluates the arithmetic expression following an operator, e.g.
+the offset of `${NAME:offset}`.
+
+ @param value 	Set to the value of the expression.
+
+ @return	See param_word(); also `-1` if the expression is invalid.
+*/
+int	param_arith(t_param *p, const char *word, size_t len, long *value)
+{
+	char	*expanded;
+	int		ret;
+
+	ret = param_word(p, word, len, &expanded);
+	if (ret <= 0)
+		return (ret);
+	if (!arith_eval(p->data, expanded, value))
+		ret = -1;
+	free(expanded);
+	return (ret);
+}
+
+/**
+Finds the first unquoted separator within a word, e.g. the `/` ending the
+pattern of `${NAME/pattern/replacement}`.
+
+ @param word 	The word.
+ @param sep 	The separator.
+
+ @return	The index of the separator, or the length of the word if there is
+			none.
+*/
+size_t	param_split(const char *word, char sep)
+{
+	t_quote	quote;
+	size_t	i;
+
+	ft_bzero(&quote, sizeof(t_quote));
+	i = 0;
+	while (word[i] && (word[i] != sep || quote.in_single || quote.in_double))
+		process_quote(word[i++], &quote.in_single, &quote.in_double);
+	return (i);
+}
@@ -0,0 +1,170 @@
+/**
+This file contains functions to find the beginnings and ends of a string
+which match a compiled glob pattern (see parser_pattern.c), as removed by
+`${NAME#pattern}` or `${NAME%pattern}` and replaced by `${NAME/pattern/rep}`.
+
+Instead of matching every possible length of the beginning (or end) again,
+the string is read once while keeping the set of elements of the pattern
+which can be reached so far: a state `p` means the elements before `p` have
+matched. After each character, the set tells whether the part read so far
+matches the whole pattern. This takes O(length of string * number of
+elements) steps for all lengths at once and stops as soon as no element can
+be reached anymore. An end is found the same way, reading the string and the
+pattern backwards.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+ssize_t	pattern_match_prefix(const t_pattern *pat, const char *str, size_t len,
+			int longest);
+ssize_t	pattern_match_suffix(const t_pattern *pat, const char *str, size_t len,
+			int longest);
+
+/**
+Used in affix_match() and step().
+
+Adds the states reachable without reading a character: a `*` can match the
+empty string, so the state after it is reached whenever the one before it
+is.
+
+ @param set 	The set of states (`pat->count + 1` flags).
+ @param rev 	`1` if the pattern is read backwards.
+*/
+static void	closure(const t_pattern *pat, unsigned char *set, int rev)
+{
+	size_t	i;
+	size_t	p;
+
+	i = 0;
+	while (i < pat->count)
+	{
+		p = i;
+		if (rev)
+			p = pat->count - 1 - i;
+		if (set[p + rev] && pat->elems[p].type == PAT_STAR)
+			set[p + !rev] = 1;
+		i++;
+	}
+}
+
+/**
+Used in affix_match().
+
+Reads one character: a `*` keeps its state, any other element which matches
+the character leads to the state after it (before it, if `rev`).
+
+ @return	`1` if any state is left, `0` if no longer beginning (or end)
+			can match.
+*/
+static int	step(const t_pattern *pat, unsigned char *set, unsigned char c,
+				int rev)
+{
+	unsigned char	*next;
+	size_t			p;
+	int				alive;
+
+	next = set + pat->count + 1;
+	ft_bzero(next, pat->count + 1);
+	alive = 0;
+	p = 0;
+	while (p < pat->count)
+	{
+		if (set[p + rev] && pat->elems[p].type == PAT_STAR)
+			next[p + rev] = 1;
+		else if (set[p + rev] && pattern_elem_match(&pat->elems[p], c))
+			next[p + !rev] = 1;
+		alive = (alive || next[p + rev] || next[p + !rev]);
+		p++;
+	}
+	ft_memcpy(set, next, pat->count + 1);
+	closure(pat, set, rev);
+	return (alive);
+}
+
+/**
+Used in pattern_match_prefix() and pattern_match_suffix().
+
+Reads the string from its beginning (or, if `rev`, from its end) and
+records every length after which the whole pattern has matched. The sets of
+states are kept in `pat->states`, allocated with the pattern.
+
+ @param pat 			The compiled pattern.
+ @param str 			The string.
+ @param len 			The length of the string.
+ @param longest_rev 	Whether the longest match is wanted (otherwise the
+ 						shortest) and whether the end is matched (otherwise
+ 						the beginning).
+
+ @return	The length of the shortest (or longest) matching beginning or
+			end, `-1` if there is none.
+*/
+static ssize_t	affix_match(const t_pattern *pat, const char *str, size_t len,
+					int longest_rev[2])
+{
+	unsigned char	*set;
+	ssize_t			found;
+	size_t			n;
+	int				rev;
+
+	rev = longest_rev[1];
+	set = pat->states;
+	ft_bzero(set, pat->count + 1);
+	set[pat->count * rev] = 1;
+	closure(pat, set, rev);
+	found = -1;
+	n = 0;
+	while (1)
+	{
+		if (set[pat->count * !rev])
+			found = n;
+		if ((found >= 0 && !longest_rev[0]) || n == len)
+			return (found);
+		if (!step(pat, set, str[(len - 1 - n) * rev + n * !rev], rev))
+			return (found);
+		n++;
+	}
+}
+
+/**
+Finds the shortest or longest beginning of a string which matches a pattern,
+as removed by `${NAME#pattern}` and `${NAME##pattern}`.
+
+ @param pat 		The compiled pattern.
+ @param str 		The string.
+ @param len 		The length of the string.
+ @param longest 	`0` for the shortest match, otherwise the longest.
+
+ @return	The length of the matching beginning, `-1` if there is none.
+*/
+ssize_t	pattern_match_prefix(const t_pattern *pat, const char *str, size_t len,
+			int longest)
+{
+	int	longest_rev[2];
+
+	longest_rev[0] = longest;
+	longest_rev[1] = 0;
+	return (affix_match(pat, str, len, longest_rev));
+}
+
+/**
+Finds the shortest or longest end of a string which matches a pattern, as
+removed by `${NAME%pattern}` and `${NAME%%pattern}`.
+
+ @param pat 		The compiled pattern.
+ @param str 		The string.
+ @param len 		The length of the string.
+ @param longest 	`0` for the shortest match, otherwise the longest.
+
+ @return	The length of the matching end, `-1` if there is none.
+*/
+ssize_t	pattern_match_suffix(const t_pattern *pat, const char *str, size_t len,
+			int longest)
+{
+	int	longest_rev[2];
+
+	longest_rev[0] = longest;
+	longest_rev[1] = 1;
+	return (affix_match(pat, str, len, longest_rev));
+}
@@ -0,0 +1,87 @@
+/**
+This file contains functions to match compiled glob patterns (see
+parser_pattern.c) against whole strings (for beginnings and ends, see
+parser_pattern_affix.c).
+
+The matching is iterative: when an element after a `*` does not match, only
+the position of the last `*` is backtracked to (a `*` before it never has to
+be retried), so a match takes at most O(length of string * number of
+elements) steps, without recursion.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	pattern_elem_match(const t_pat_elem *elem, unsigned char c);
+int	pattern_match(const t_pattern *pat, const char *str, size_t len);
+
+/**
+Checks if a single character matches an element other than `PAT_STAR`. The
+element after the last one of a pattern is a `PAT_CHAR` of `\0` (see
+pattern_compile()), which matches no character of a string.
+*/
+int	pattern_elem_match(const t_pat_elem *elem, unsigned char c)
+{
+	if (elem->type == PAT_ANY)
+		return (1);
+	if (elem->type == PAT_CHAR)
+		return (elem->c == c);
+	return ((elem->set[c / 8] >> (c % 8)) & 1);
+}
+
+/**
+Used in pattern_match().
+
+Continues after an element did not match: the last `*` then takes one more
+character and the elements following it are tried again from there.
+
+ @param star 	The index of the element after the last `*` (`0` if there
+				was none yet) and the index of the string where it
+				started.
+
+ @return	`1` if there was a `*` to backtrack to, `0` otherwise.
+*/
+static int	backtrack(size_t *p, size_t *s, size_t star[2])
+{
+	if (!star[0])
+		return (0);
+	*p = star[0];
+	*s = ++star[1];
+	return (1);
+}
+
+/**
+Checks if a whole string matches a pattern.
+
+ @param pat 	The compiled pattern.
+ @param str 	The string (not necessarily null-terminated).
+ @param len 	The length of the string.
+
+ @return	`1` if the string matches, `0` otherwise.
+*/
+int	pattern_match(const t_pattern *pat, const char *str, size_t len)
+{
+	size_t	p;
+	size_t	s;
+	size_t	star[2];
+
+	p = 0;
+	s = 0;
+	ft_bzero(star, sizeof(star));
+	while (s < len)
+	{
+		if (pat->elems[p].type == PAT_STAR)
+		{
+			star[0] = ++p;
+			star[1] = s;
+		}
+		else if (pattern_elem_match(&pat->elems[p++], str[s]))
+			s++;
+		else if (!backtrack(&p, &s, star))
+			return (0);
+	}
+	while (pat->elems[p].type == PAT_STAR)
+		p++;
+	return (p == pat->count);
+}
@@ -0,0 +1,138 @@
+/**
+This file contains functions for process substitution: `<(command)` and
+`>(command)` are replaced with a path like `/dev/fd/63`, through which the
+command being expanded reads the output of `command` or writes to its input
+(see execution_procsubst.c). The commands of the substitutions run
+concurrently with it and are waited for once it finished.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	expand_procsubst(char **str, t_data *data);
+
+/**
+Used in expand_procsubst().
+
+Checks if a process substitution starts at index `i` of the string, i.e.
+`<(` or `>(`, and finds its end: the `)` closing it (see paren_end()).
+
+ @param str 	The string.
+ @param i 		The index of the `<` or `>`.
+
+ @return	The index after the closing `)`, or `0` if there is no
+			(complete) process substitution.
+*/
+static int	procsubst_end(const char *str, int i)
+{
+	if ((str[i] != '<' && str[i] != '>') || str[i + 1] != '(')
+		return (0);
+	return (paren_end(str, i + 1));
+}
+
+/**
+Used in expand_procsubst().
+
+Finds the end of an expansion which is skipped as a whole, as a `<(` within
+it is no process substitution (it is expanded later on, see
+process_variable()): an arithmetic or parameter expansion or a command
+substitution.
+
+ @param str 	The string.
+ @param i 		The index of the `$` or backtick.
+
+ @return	The index after the expansion, or `0` if none starts at `i`.
+*/
+static int	expansion_end(const char *str, int i)
+{
+	int	end;
+
+	end = arith_end(str, i);
+	if (!end)
+		end = subst_end(str, i);
+	if (!end)
+		end = param_end(str, i);
+	return (end);
+}
+
+/**
+Used in expand_procsubst().
+
+Starts the process substitution at index `*i` of the string (see
+start_procsubst()) and replaces it with the path of its pipe.
+
+ @param str 	Pointer to the string, which is replaced by a new one.
+ @param i 		Pointer to the index of the `<` or `>`, moved after the path.
+ @param end 	The index after the closing `)`.
+ @param data 	Pointer to the data struct.
+
+ @return	See expand_procsubst().
+*/
+static int	replace_procsubst(char **str, int *i, int end, t_data *data)
+{
+	char	*cmd;
+	char	*fd;
+	char	*path;
+	int		ret;
+
+	cmd = ft_substr(*str, *i + 2, end - *i - 3);
+	if (!cmd)
+		return (0);
+	ret = start_procsubst(data, cmd, (*str)[*i]);
+	free(cmd);
+	if (ret < 0)
+		return (-1);
+	fd = ft_itoa(ret);
+	path = NULL;
+	if (fd)
+		path = ft_strjoin(PROCSUBST_DIR, fd);
+	free(fd);
+	ret = (path && replace_range(str, *i, end, path));
+	if (ret)
+		*i += ft_strlen(path);
+	free(path);
+	return (ret);
+}
+
+/**
+Used in expand_vars_and_trim_quotes().
+
+Replaces every process substitution within a word which is neither quoted
+nor part of another expansion. It is done before the other expansions, so
+their results are never taken for a process substitution. The commands are
+started right away; the substitutions are finished after the command (see
+finish_procsubst()).
+
+ @param str 	Pointer to the word, which is replaced by a new one.
+ @param data 	Pointer to the data struct.
+
+ @return	`1` on success.
+			`0` on malloc failure.
+			`-1` if a command could not be started (an error message was
+			printed).
+*/
+int	expand_procsubst(char **str, t_data *data)
+{
+	t_quote	quote;
+	int		end;
+	int		ret;
+	int		i;
+
+	ft_bzero(&quote, sizeof(t_quote));
+	i = 0;
+	ret = 1;
+	while ((*str)[i] && ret > 0)
+	{
+		end = 0;
+		if (!quote.in_single && !quote.in_double)
+			end = procsubst_end(*str, i);
+		if (end)
+			ret = replace_procsubst(str, &i, end, data);
+		else if (!quote.in_single && expansion_end(*str, i))
+			i = expansion_end(*str, i);
+		else
+			process_quote((*str)[i++], &quote.in_single, &quote.in_double);
+	}
+	return (ret);
+}
@@ -0,0 +1,192 @@
+/**
+This file contains the parsing of a whole command line with control flow into
+a command list (see parser_compound.c), which is stored in `data->program`:
+If a compound command is not complete at the end of the line, the following
+lines are read until it is, after the bodies of the heredocs on the lines
+before (see parser_heredoc_collect.c). The bodies are read once, when the
+list is complete, and expanded on every execution of their command (see
+parser_heredoc_keep.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+int	is_compound(t_data *data);
+int	parse_program(t_data *data);
+
+/**
+Used in handle_input().
+
+Checks if the token list has to be parsed into a command list: if it starts
+with a reserved word or contains a separator. Any other line is a single
+pipeline, which is executed directly.
+
+ @param data 	Pointer to the data struct containing the token list.
+
+ @return	`1` if the line is a command list, `0` otherwise.
+*/
+int	is_compound(t_data *data)
+{
+	t_list	*cur;
+
+	cur = data->tok.tok_lst;
+	if (!cur)
+		return (0);
+	if (is_list_end(cur) || is_reserved_word(cur, "if")
+		|| is_reserved_word(cur, "while") || is_reserved_word(cur, "until")
+		|| is_reserved_word(cur, "for"))
+		return (1);
+	while (cur)
+	{
+		if (((t_token *)cur->content)->type == SEPARATOR)
+			return (1);
+		cur = cur->next;
+	}
+	return (0);
+}
+
+/**
+Used in read_continuation().
+
+Reads the next line of input: via readline() with the heredoc prompt in
+interactive mode, otherwise from the script.
+
+ @return	The line, or `NULL` at the end of the input or if the prompt was
+			interrupted by CTRL + C (also printing an error message for the
+			end of the input).
+*/
+static char	*read_next_line(t_data *data)
+{
+	char	*line;
+
+	if (data->interactive)
+	{
+		line = readline(HEREDOC_P);
+		ft_ms_adopt(line);
+	}
+	else
+		line = read_script_line(data);
+	if (g_signal)
+	{
+		free(line);
+		return (NULL);
+	}
+	if (!line)
+	{
+		print_err_msg_custom(ERR_SYNTAX_EOF, 1, 1);
+		data->exit_status = ENOENT;
+	}
+	return (line);
+}
+
+/**
+Used in parse_program().
+
+Continues an incomplete command list on the next line: The bodies of the
+heredocs on the last line are read first (see collect_heredocs()), then
+the next line is appended to the input, separated by a newline (which
+separates commands like `;`), and the whole input is tokenized again.
+
+ @return	`1` on success, `0` if there was no more input or tokenizing
+			failed.
+*/
+static int	read_continuation(t_data *data)
+{
+	char		*line;
+	t_strbuf	sb;
+	int			ok;
+
+	if (!collect_heredocs(data))
+		return (0);
+	line = read_next_line(data);
+	if (!line)
+		return (0);
+	ft_sb_init(&sb);
+	ok = ft_sb_adds(&sb, data->input) && ft_sb_addc(&sb, '\n')
+		&& ft_sb_adds(&sb, line);
+	free(line);
+	if (!ok)
+	{
+		ft_sb_free(&sb);
+		print_err_msg(ERR_MALLOC);
+		return (0);
+	}
+	free(data->input);
+	data->input = ft_sb_steal(&sb);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok.tok_last = NULL;
+	return (get_cached_tokens(data) && strip_time_keyword(data));
+}
+
+/**
+Used in parse_program().
+
+Stores the heredoc bodies of all commands in a command list with their
+commands, in the order they appear (see keep_heredocs()). `pipe_nr` keeps
+counting across all commands, so the heredoc files of every command can be
+deleted afterwards; it is reset before a command is executed.
+
+ @return	`1` on success, `0` on malloc failure (an error message was
+			printed).
+*/
+static int	prepare_heredocs(t_data *data, t_node *node)
+{
+	int	ret;
+
+	ret = 1;
+	while (node && ret > 0)
+	{
+		if (node->type == NODE_CMD)
+			ret = keep_heredocs(data, node);
+		else
+		{
+			ret = prepare_heredocs(data, node->cond);
+			if (ret > 0)
+				ret = prepare_heredocs(data, node->body);
+			if (ret > 0)
+				ret = prepare_heredocs(data, node->other);
+		}
+		node = node->next;
+	}
+	return (ret);
+}
+
+/**
+Used in run_compound().
+
+Parses the token list into a command list (`data->program`), reading more
+lines while it is incomplete, and reads the heredoc bodies of its last line
+(see collect_heredocs()) before storing all of them. The token list and the
+heredoc lines read ahead are not needed afterwards and freed.
+
+ @param data 	Pointer to the data struct.
+
+ @return	`1` on success, `0` on any error (an error message was printed).
+*/
+int	parse_program(t_data *data)
+{
+	t_list	*cur;
+	int		ret;
+
+	ret = -1;
+	while (ret == -1)
+	{
+		free_nodes(data->program);
+		data->program = NULL;
+		cur = data->tok.tok_lst;
+		ret = parse_list(data, &cur, &data->program);
+		if (ret > 0 && cur)
+			ret = syntax_error(data, cur);
+		if (ret == -1 && !read_continuation(data))
+			ret = -2;
+	}
+	if (ret > 0)
+		ret = collect_heredocs(data);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok.tok_last = NULL;
+	if (ret > 0)
+		ret = prepare_heredocs(data, data->program);
+	ft_lstclear(&data->heredoc_lines, free);
+	return (ret > 0);
+}
@@ -10,46 +10,90 @@ including environment variable expansion, quote trimming, and heredoc processing
 
 int	parse_tokens(t_data *data);
 
+/**
+Used in expand_vars_and_trim_quotes().
+
+Expands a token of type `OTHER`: process substitutions first, then variables
+and the other expansions, then pathname expansion (see parser_glob.c), unless
+it is the operand of a redirection. Paired quotes are removed from the result
+unless it was replaced with the names of matching files.
+
+ @param data 	Pointer to the data struct, with the token in
+				`data->tok.curr_node` (moved to the last match if the token
+				is replaced with several ones).
+ @param token 	The token.
+ @param glob 	Whether pathname expansion is done.
+
+ @return	See expand_vars_and_trim_quotes().
+*/
+static int	expand_token(t_data *data, t_token *token, bool glob)
+{
+	char	*trimmed_lexeme;
+	int		ret;
+
+	ret = expand_procsubst(&token->lexeme, data); // start process substitutions
+	if (ret > 0)
+		ret = expand_variables(&token->lexeme, data, 0); // expand variables in the lexeme
+	if (ret <= 0)
+		return (ret * 2);
+	ret = 0;
+	if (glob)
+		ret = expand_glob(data); // replace a pattern with the matching files
+	if (ret != 0)
+		return (ret > 0);
+	trimmed_lexeme = trim_paired_quotes(token->lexeme); // remove paired quotes from the lexeme
+	if (!trimmed_lexeme)
+		return (-1);
+	free(token->lexeme); // free the old lexeme
+	token->lexeme = trimmed_lexeme; // set the new lexeme
+	return (1);
+}
+
 /**
 Expands environment variables in token lexemes and then removes paired quotes
 from these lexemes.
 
-This function traverses a linked list of tokens and performs two main operations
-on lexemes of type `OTHER`:
- 1.	Variable Expansion: Replaces any environment variables within the lexeme with
+This function traverses a linked list of tokens and performs these operations
+on lexemes of type `OTHER` (see expand_token()):
+ 1.	Process Substitution: Replaces `<(cmd)` and `>(cmd)` with the path of a
+ 	pipe to the started command (see parser_procsubst.c).
+ 2.	Variable Expansion: Replaces any environment variables within the lexeme with
  	their corresponding values, respecting expansion rules within quotes.
- 2.	Quote Removal: Removes paired single and double quotation characters from
+ 3.	Pathname Expansion: Replaces a pattern like `*.c` with the matching file
+ 	names, which may add tokens, so the tokens are numbered again after.
+ 4.	Quote Removal: Removes paired single and double quotation characters from
  	the lexeme.
 
  @param data 	Pointer to the data structure containing the list of tokens and
  				environment information.
 
  @return		`1` if all tokens were processed successfully;
-				`0` if variable expansion failed;
-				`-1` if trimming paired quotes failed.
+				`0` if variable or pathname expansion failed;
+				`-1` if trimming paired quotes failed;
+				`-2` if an expansion was invalid or a command could not be
+				run (an error message was printed).
 */
 static int	expand_vars_and_trim_quotes(t_data *data)
 {
-	t_list	*current_node;
-	t_token	*current_token;
-	char	*trimmed_lexeme;
+	t_token_type	prev_type;
+	int				ret;
 
-	current_node = data->tok.tok_lst;
-	while (current_node != NULL) // traverse the token linked list
+	prev_type = OTHER;
+	data->tok.curr_node = data->tok.tok_lst;
+	while (data->tok.curr_node != NULL) // traverse the token linked list
 	{
-		current_token = (t_token *)current_node->content;
-		if (current_token->type == OTHER)
+		data->tok.curr_tok = (t_token *)data->tok.curr_node->content;
+		if (data->tok.curr_tok->type == OTHER)
 		{
-			if (!expand_variables(&current_token->lexeme, data, 0)) // expand variables in the lexeme
-				return (0);
-			trimmed_lexeme = trim_paired_quotes(current_token->lexeme); // remove paired quotes from the lexeme
-			if (!trimmed_lexeme)
-				return (-1);
-			free(current_token->lexeme); // free the old lexeme
-			current_token->lexeme = trimmed_lexeme; // set the new lexeme
+			ret = expand_token(data, data->tok.curr_tok,
+					!is_redir_token(prev_type)); // no globbing of redirection operands
+			if (ret <= 0)
+				return (ret);
 		}
-		current_node = current_node->next;
+		prev_type = ((t_token *)data->tok.curr_node->content)->type;
+		data->tok.curr_node = data->tok.curr_node->next;
 	}
+	number_tokens(data->tok.tok_lst); // matches may have added tokens
 	return (1);
 }
 
@@ -70,19 +114,20 @@ int	parse_tokens(t_data *data)
 	int	return_heredocs;
 	int	return_expansion_quote_trim;
 
-	return_heredocs = process_heredocs(data);
+	return_heredocs = trace_call(data, PH_HEREDOCS, process_heredocs);
 	if (return_heredocs <= 0)
 	{
 		if (return_heredocs == 0) // return is '-1' if CTRL+C during heredoc prompt, don't print ERR MESSAGE then
 			print_err_msg(ERR_PARSE_HEREDOC);
 		return (0);
 	}
-	return_expansion_quote_trim = expand_vars_and_trim_quotes(data);
+	return_expansion_quote_trim = trace_call(data, PH_EXPANSION,
+			expand_vars_and_trim_quotes);
 	if (return_expansion_quote_trim <= 0)
 	{
 		if (return_expansion_quote_trim == 0)
 			print_err_msg(ERR_EXP_VAR);
-		else
+		else if (return_expansion_quote_trim == -1)
 			print_err_msg(ERR_TRIM_QUOTE);
 		return (0);
 	}
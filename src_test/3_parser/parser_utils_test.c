@@ -1,6 +1,7 @@
 /**
 This file contains functions for processing strings with respect to
-quotation marks as well as for variable identification.
+quotation marks as well as for variable identification, replacing parts
+of a string with the result of an expansion and expanding such parts.
 */
 
 #include "minishell.h"
@@ -10,6 +11,8 @@ quotation marks as well as for variable identification.
 bool	process_quote(char ch, bool *in_single_quote, bool *in_double_quote);
 char	*trim_paired_quotes(const char *str);
 int		is_variable(char *str, int i);
+int		replace_range(char **str, int start, int end, const char *value);
+int		expand_nested(char **str, t_data *data);
 
 /**
 Toggles the state of quote flags based on the current character.
@@ -77,15 +80,72 @@ char	*trim_paired_quotes(const char *str)
 /**
 Checks if a valid variable is encountered at position `i` in the string `str`.
 A valid variable is identified by a '$' character that is followed by at least
-one alphanumerical character or '?' (special variable '$?': exit status).
+one alphanumerical character, '_' or '?' (special variable '$?': exit status).
 
  @return	`1` if a valid variable is encountered.
 			`0` if no valid variable is encountered.
 */
 int	is_variable(char *str, int i)
 {
-	if (str[i] == '$' && (ft_isalnum(str[i + 1]) || str[i + 1] == '?'))
+	if (str[i] == '$' && (ft_isalnum(str[i + 1]) || str[i + 1] == '_'
+			|| str[i + 1] == '?'))
 		return (1);
 	else
 		return (0);
 }
+
+/**
+Replaces the characters of a string from index `start` up to (excluding)
+index `end` with `value`, e.g. an expansion with its result.
+
+ @param str 	Pointer to the string, which is replaced by a new one.
+ @param start 	The index of the first character to replace.
+ @param end 	The index after the last character to replace.
+ @param value 	The replacement.
+
+ @return	`1` on success.
+			`0` on malloc failure (`str` is unchanged).
+*/
+int	replace_range(char **str, int start, int end, const char *value)
+{
+	t_strbuf	sb;
+	char		*new_str;
+
+	ft_sb_init(&sb);
+	if (!ft_sb_addn(&sb, *str, start) || !ft_sb_adds(&sb, value)
+		|| !ft_sb_adds(&sb, *str + end))
+	{
+		ft_sb_free(&sb);
+		return (0);
+	}
+	new_str = ft_sb_steal(&sb);
+	if (!new_str)
+		return (0);
+	free(*str);
+	*str = new_str;
+	return (1);
+}
+
+/**
+Expands the variables (and nested expansions) within a part of a string on
+its own, e.g. the expression of an arithmetic expansion or the word of a
+parameter expansion. The quotation state of the surrounding string is kept
+aside meanwhile.
+
+ @param str 	Pointer to the part, which is replaced by the expanded one.
+ @param data 	Pointer to the data struct.
+
+ @return	See expand_variables().
+*/
+int	expand_nested(char **str, t_data *data)
+{
+	t_quote	quote;
+	int		ret;
+
+	quote = data->quote;
+	data->quote.in_single = false;
+	data->quote.in_double = false;
+	ret = expand_variables(str, data, 0);
+	data->quote = quote;
+	return (ret);
+}
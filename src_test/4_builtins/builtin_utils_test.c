@@ -5,7 +5,8 @@ int	is_builtin(t_exec *exec)
 	if (!ft_strcmp(exec->cmd, "unset") || !ft_strcmp(exec->cmd, "echo")
 		|| !ft_strcmp(exec->cmd, "exit") || !ft_strcmp(exec->cmd, "cd")
 		|| !ft_strcmp(exec->cmd, "export") || !ft_strcmp(exec->cmd, "env")
-		|| !ft_strcmp(exec->cmd, "pwd"))
+		|| !ft_strcmp(exec->cmd, "pwd") || !ft_strcmp(exec->cmd, "times")
+		|| !ft_strcmp(exec->cmd, "memstat") || !ft_strcmp(exec->cmd, "let"))
 		return (1);
 	return (0);
 }
@@ -13,8 +14,9 @@ int	is_builtin(t_exec *exec)
 int	is_parent_builtin(t_exec *exec)
 {
 	if (!ft_strcmp(exec->cmd, "cd") || !ft_strcmp(exec->cmd, "unset")
-		|| !ft_strcmp(exec->cmd, "exit") || (!ft_strcmp(exec->cmd, "export")
-			&& exec->flags[1]))
+		|| !ft_strcmp(exec->cmd, "exit") || !ft_strcmp(exec->cmd, "times")
+		|| !ft_strcmp(exec->cmd, "memstat") || !ft_strcmp(exec->cmd, "let")
+		|| (!ft_strcmp(exec->cmd, "export") && exec->flags[1]))
 		return (1);
 	return (0);
 }
@@ -66,17 +66,11 @@ static int	cd_to_home_user(t_cd **cd, t_env *envp_temp)
 // Throws an error if the defined subdirectory doesn't exist.
 static int	cd_one_down(t_cd **cd, char *cwd, t_exec *exec)
 {
-	char	*input;
-
 	if (chdir(exec->flags[1]) == 0) // If it is an absolute path, then return.
 		return (0);
 	if (!cwd) // If cwd was actually NULL after getcwd-call.
 		return (1);
-	input = ft_strjoin("/", exec->flags[1]); // Add a '/' in front of the input directory, to make it valid.
-	if (!input) // Protecting the malloc.
-		print_error_cd(1, cd);
-	(*cd)->subdirectory = ft_strjoin(cwd, input); // Creating the new path by concatening the input directory to the current one.
-	free(input);
+	(*cd)->subdirectory = ft_strjoin_n(3, cwd, "/", exec->flags[1]); // Creating the new path "cwd/input" in a single allocation.
 	if (!(*cd)->subdirectory) // Protecting the malloc.
 		print_error_cd(1, cd);
 	if (chdir((*cd)->subdirectory) == -1) // Changing to the new directory.
@@ -16,12 +16,12 @@ void	print_echo(t_exec *exec, bool print_newline)
 		str = 1;
 	while (exec->flags[str])
 	{
-		printf("%s", exec->flags[str++]);
+		out_add(exec, exec->flags[str++]);
 		if (exec->flags[str])
-			printf(" ");
+			out_add(exec, " ");
 	}
 	if (print_newline)
-		printf("\n");
+		out_add(exec, "\n");
 }
 
 // Works like the "echo"-command, essentially outputting whatever is passed
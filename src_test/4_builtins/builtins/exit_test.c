@@ -41,7 +41,8 @@ unsigned int	exit_with_code(t_data *data, t_exec *exec)
 	{
 		free_exec(exec);
 		free_data(data, 1);
-		printf("exit\n");
+		if (data->interactive)
+			printf("exit\n");
 		return (0);
 	}
 	if (check_multiple_signs_exit_code(exit_arg))
@@ -49,7 +50,8 @@ unsigned int	exit_with_code(t_data *data, t_exec *exec)
 	exit_code = (unsigned int) ft_atoi(exit_arg); // Converting the numeral part of the string to an unsigned int.
 	free_exec(exec);
 	free_data(data, 1);
-	printf("exit\n"); // Prints "exit" on the STOUT.
+	if (data->interactive) // Like bash, only prints "exit" in interactive mode.
+		printf("exit\n"); // Prints "exit" on the STOUT.
 	return (exit_code); // Returning the exit code.
 }
 
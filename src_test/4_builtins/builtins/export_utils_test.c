@@ -1,13 +1,20 @@
 #include "minishell.h"
 
-// Checks if the environmental variable already exists in the list.
+// Checks if the environmental variable already exists in the list. The whole
+// name has to match, so "A=1" doesn't match a variable "AB".
 // @param env_list Can be either export_list or envp_temp.
 // @param arg The current argument to the "export"-command.
 static t_env	*check_if_envar_exists(t_env *env_list, char *arg)
 {
+	size_t	len;
+
+	len = ft_strlen(arg);
+	if (ft_strchr(arg, '='))
+		len = ft_strchr_index(arg, '=');
 	while (env_list)
 	{
-		if (ft_strncmp(env_list->e_var, arg, ft_strchr_index(arg, '=')) == 0)
+		if (ft_strncmp(env_list->e_var, arg, len) == 0
+			&& env_list->e_var[len] == '\0')
 			return (env_list);
 		env_list = env_list->next;
 	}
@@ -67,7 +74,6 @@ void	add_env_var_no_value(t_data *data, char *arg)
 	if (!node->e_var)
 		export_mem_alloc_failure(data);
 	node->value = NULL;
-	node->printed = 0;
 	add_to_export_list_alphabetical(&data->export_list, node);
 }
 
@@ -94,13 +100,12 @@ void	add_env_var_export_with_value(t_data *data, char *arg)
 		node->e_var = ft_substr(arg, 0, ft_strchr_index(arg, '='));
 		node->value = ft_substr(arg, ft_strchr_index(arg, '=') + 1, \
 		ft_strlen(arg));
-		node->printed = 0;
 		add_to_export_list_alphabetical(&data->export_list, node);
 	}
 	else
 	{
 		node = check_if_envar_exists(data->export_list, arg);
-		free(node->value);
+		env_free(node->value);
 		node->value = ft_substr(arg, ft_strchr_index(arg, '=') \
 		+ 1, ft_strlen(arg));
 	}
@@ -131,13 +136,12 @@ void	add_env_var_envp_with_value(t_data *data, char *arg)
 		node->e_var = ft_substr(arg, 0, ft_strchr_index(arg, '='));
 		node->value = ft_substr(arg, ft_strchr_index(arg, '=') + 1, \
 		ft_strlen(arg));
-		node->printed = 0;
 		ft_env_tmp_add_back(&data->envp_temp, node);
 	}
 	else
 	{
 		node = check_if_envar_exists(data->envp_temp, arg);
-		free(node->value);
+		env_free(node->value);
 		node->value = ft_substr(arg, ft_strchr_index(arg, '=') \
 		+ 1, ft_strlen(arg));
 	}
@@ -0,0 +1,27 @@
+#include "minishell.h"
+
+/*Works like the "let"-command in bash: Evaluates each argument as an
+arithmetic expression (see parser_arith_eval.c), e.g. 'let i++' or
+'let "x = y * 2"', without forking 'expr'. Returns 0 if the value of the
+last expression is not 0, otherwise (or on an invalid expression) 1. Runs in
+the parent, so its assignments change the shell's environment.*/
+int	minishell_let(t_data *data, t_exec *exec)
+{
+	long	value;
+	int		i;
+
+	if (!exec->flags[1])
+	{
+		print_err_msg_custom("let: expression expected", 1, 1);
+		return (1);
+	}
+	value = 0;
+	i = 1;
+	while (exec->flags[i])
+	{
+		if (!arith_eval(data, exec->flags[i], &value))
+			return (1);
+		i++;
+	}
+	return (value == 0);
+}
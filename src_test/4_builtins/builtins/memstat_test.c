@@ -0,0 +1,28 @@
+#include "minishell.h"
+
+/*Prints the allocation counters of the shell (see memstat.c): the bytes
+currently allocated, their peak and the allocations per phase. Runs in the
+parent, as a child process would only report its own copy of the counters.
+Only available in a build with 'make MEMSTAT=1'.*/
+int	minishell_memstat(t_exec *exec)
+{
+	t_strbuf	sb;
+
+	if (!FT_MEMSTAT)
+	{
+		ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
+		ft_putstr_fd("memstat: not available, build with 'make MEMSTAT=1'\n",
+			STDERR_FILENO);
+		return (1);
+	}
+	ft_sb_init(&sb);
+	if (!memstat_report(&sb))
+	{
+		ft_sb_free(&sb);
+		print_err_msg_prefix("memstat");
+		return (1);
+	}
+	out_add(exec, sb.buf);
+	ft_sb_free(&sb);
+	return (0);
+}
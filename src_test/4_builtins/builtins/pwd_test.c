@@ -13,7 +13,10 @@ int	pwd(t_exec *exec)
 			return (pwd_invalid_option(exec->flags[1], 0));
 	}
 	if (getcwd(cwd, sizeof(cwd))) // Checking that getcwd-function works. It is used to find current working directory.
-		printf("%s\n", cwd); // Printing the current working directory.
+	{
+		out_add(exec, cwd); // Buffering the current working directory, it gets printed by builtin().
+		out_add(exec, "\n");
+	}
 	else
 		print_err_msg_prefix("pwd"); // If getcwd fails, this function will print an error.
 	return (0);
@@ -0,0 +1,52 @@
+#include "minishell.h"
+
+/*Adds a duration given in microseconds to the string buffer, in the format
+used by bash for 'time' and 'times', e.g. "0m0.004s".*/
+int	add_duration(t_strbuf *sb, long usec)
+{
+	long	sec;
+	long	ms;
+
+	sec = usec / 1000000;
+	ms = (usec % 1000000) / 1000;
+	return (ft_sb_addnbr(sb, sec / 60) && ft_sb_addc(sb, 'm')
+		&& ft_sb_addnbr(sb, sec % 60) && ft_sb_addc(sb, '.')
+		&& (ms >= 100 || ft_sb_addc(sb, '0'))
+		&& (ms >= 10 || ft_sb_addc(sb, '0'))
+		&& ft_sb_addnbr(sb, ms) && ft_sb_addc(sb, 's'));
+}
+
+/*Adds one line of 'times' to the builtin's output: the user and the system
+CPU time of the given resource usage.*/
+static void	add_usage_line(t_exec *exec, struct rusage *usage)
+{
+	t_strbuf	sb;
+
+	ft_sb_init(&sb);
+	if (add_duration(&sb, usage->ru_utime.tv_sec * 1000000L
+			+ usage->ru_utime.tv_usec) && ft_sb_addc(&sb, ' ')
+		&& add_duration(&sb, usage->ru_stime.tv_sec * 1000000L
+			+ usage->ru_stime.tv_usec) && ft_sb_addc(&sb, '\n'))
+		out_add(exec, sb.buf);
+	ft_sb_free(&sb);
+}
+
+/*Works like the "times"-command in bash: Prints the accumulated user and
+system CPU time of the shell itself (first line) and of all its finished
+children (second line). Runs in the parent, as a child process would only
+report its own usage.*/
+int	minishell_times(t_exec *exec)
+{
+	struct rusage	self;
+	struct rusage	children;
+
+	if (getrusage(RUSAGE_SELF, &self) == -1
+		|| getrusage(RUSAGE_CHILDREN, &children) == -1)
+	{
+		print_err_msg_prefix("times");
+		return (1);
+	}
+	add_usage_line(exec, &self);
+	add_usage_line(exec, &children);
+	return (0);
+}
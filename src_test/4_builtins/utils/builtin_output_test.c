@@ -0,0 +1,65 @@
+#include "minishell.h"
+
+/*Writes len bytes of buf to fd, continuing after partial writes (e.g. into
+a full pipe) and interrupted system calls.
+Returns 0 on success, -1 if writing failed.*/
+static int	write_all(int fd, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, buf, len);
+		if (written == -1 && errno == EINTR)
+			continue ;
+		if (written == -1)
+			return (-1);
+		buf += written;
+		len -= written;
+	}
+	return (0);
+}
+
+/*Writes everything the builtin has printed so far to STDOUT with a single
+write (unless the pipe or file only accepts part of it at once), and resets
+the buffer, keeping its memory for the next builtin. If the output of the
+builtin is captured by a command substitution (see execution_subst.c), it is
+appended to exec->capture instead, without any write.
+Returns 0 on success, 1 if writing failed (e.g. "echo hi > /dev/full").*/
+int	out_flush(t_exec *exec)
+{
+	int	status;
+
+	status = 0;
+	if (exec->capture && exec->out.len > 0
+		&& !ft_sb_addn(exec->capture, exec->out.buf, exec->out.len))
+	{
+		print_err_msg(ERR_MALLOC);
+		status = 1;
+	}
+	else if (!exec->capture && exec->out.len > 0
+		&& write_all(STDOUT_FILENO, exec->out.buf, exec->out.len) == -1)
+	{
+		print_err_msg_prefix(exec->cmd);
+		status = 1;
+	}
+	ft_sb_reset(&exec->out);
+	return (status);
+}
+
+/*Adds a string to the output of the current builtin. Builtins print through
+this buffer instead of printf(), so their whole output is written at once by
+out_flush(), independent of stdio's buffering (which differs between a
+terminal and a pipe) and without interleaving with direct writes to the same
+fd. If the buffer can't grow, whatever is buffered and the string itself are
+written directly instead, so no output gets lost (unless it is captured).*/
+void	out_add(t_exec *exec, const char *s)
+{
+	if (ft_sb_adds(&exec->out, s))
+		return ;
+	out_flush(exec);
+	if (!exec->capture)
+		write_all(STDOUT_FILENO, s, ft_strlen(s));
+	else if (!ft_sb_adds(exec->capture, s))
+		print_err_msg(ERR_MALLOC);
+}
@@ -1,11 +1,15 @@
 #include "minishell.h"
 
-/*Frees the memory of a struct of type t_env. See minishell.h for declaration*/
+/*Frees the memory of a struct of type t_env. See minishell.h for declaration.
+Nodes and strings imported at startup are part of the slab and stay (see
+env_free()).*/
 void	free_env_struct(t_env **head)
 {
 	t_env	*current;
 	t_env	*next_node;
 
+	if (!head)
+		return ;
 	current = *head;
 	if (current)
 	{
@@ -13,11 +17,11 @@ void	free_env_struct(t_env **head)
 		{
 			next_node = current->next;
 			if (current->value)
-				free(current->value);
+				env_free(current->value);
 			if (current->e_var)
-				free(current->e_var);
+				env_free(current->e_var);
 			if (current)
-				free(current);
+				env_free(current);
 			current = NULL;
 			current = next_node;
 		}
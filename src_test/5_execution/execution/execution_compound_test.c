@@ -0,0 +1,101 @@
+#include "minishell.h"
+
+/*Executes a pipeline of a command list: A copy of its tokens goes through
+heredocs, expansion and quote removal like any other command line (so
+variables are expanded anew on every execution, also in the bodies of its
+heredocs, which are read from a copy of the lines kept with it), then it is
+executed and its process substitutions are finished. The positions of the
+tokens already start at 0, as the execution expects.*/
+static void	run_command(t_data *data, t_node *node)
+{
+	if (load_heredocs(data, node))
+		data->tok.tok_lst = copy_tokens(node->tokens, NULL);
+	if (!data->tok.tok_lst)
+	{
+		ft_lstclear(&data->heredoc_lines, free);
+		print_err_msg(ERR_MALLOC);
+		data->exit_status = 1;
+		return ;
+	}
+	data->tok.tok_last = ft_lstlast(data->tok.tok_lst);
+	data->pipe_nr = 0;
+	if (parse_tokens(data))
+	{
+		handle_signals_exec();
+		sync_script_input(data);
+		trace_lap(data);
+		init_exec(data);
+	}
+	finish_procsubst(data);
+	ft_lstclear(&data->heredoc_lines, free);
+	ft_lstclear(&data->tok.tok_lst, del_token);
+	data->tok.tok_last = NULL;
+}
+
+/*Executes an 'if': the body if the condition succeeded (exit status 0),
+otherwise the 'else' part. Without an 'else' part the exit status is 0.*/
+static void	run_if(t_data *data, t_node *node)
+{
+	run_list(data, node->cond);
+	if (g_signal)
+		return ;
+	if (data->exit_status == 0)
+		run_list(data, node->body);
+	else if (node->other)
+		run_list(data, node->other);
+	else
+		data->exit_status = 0;
+}
+
+/*Executes a 'while' (or 'until') loop: the body as long as the condition
+succeeds (or fails). The exit status is the one of the last execution of the
+body, 0 if it was not executed at all. CTRL + C stops the loop.*/
+static void	run_loop(t_data *data, t_node *node)
+{
+	unsigned int	status;
+
+	status = 0;
+	while (!g_signal)
+	{
+		run_list(data, node->cond);
+		if (g_signal
+			|| (data->exit_status == 0) != (node->type == NODE_WHILE))
+			break ;
+		run_list(data, node->body);
+		status = data->exit_status;
+	}
+	if (!g_signal)
+		data->exit_status = status;
+}
+
+/*Executes the commands of a command list one after the other. The exit
+status is the one of the last command. CTRL + C stops the list.*/
+void	run_list(t_data *data, t_node *node)
+{
+	while (node && !g_signal)
+	{
+		if (node->type == NODE_CMD)
+			run_command(data, node);
+		else if (node->type == NODE_IF)
+			run_if(data, node);
+		else if (node->type == NODE_FOR)
+			run_for(data, node);
+		else
+			run_loop(data, node);
+		node = node->next;
+	}
+}
+
+/*Parses a command line with control flow into a command list and executes
+it. Each command resets the pipe counter, which also numbers the heredoc
+files of the whole list, so it is restored for deleting them afterwards.*/
+void	run_compound(t_data *data)
+{
+	int	heredocs;
+
+	if (!parse_program(data))
+		return ;
+	heredocs = data->pipe_nr;
+	run_list(data, data->program);
+	data->pipe_nr = heredocs;
+}
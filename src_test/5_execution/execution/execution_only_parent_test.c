@@ -20,40 +20,26 @@ void	reset_exec(t_exec *exec)
 	}
 }
 
-/*Checking for the existence of an infile or outfile, and handles this
-the same way as bash. If an infile doesn't exist, it throws out an error
-message. If an outfile doesn't exist, the outfile is created.*/
-void	check_file_exist_parent(t_data *data, t_exec *exec)
-{
-	if (exec->redir_in)
-	{
-		if (access(exec->infile, F_OK) == -1)
-			redirections_errors(data, exec, 0, 1);
-	}
-	if (exec->redir_out)
-	{
-		if (access(exec->outfile, F_OK == -1))
-		{
-			exec->outfile_fd = open(exec->outfile, O_CREAT);
-			if (exec->outfile_fd == -1)
-				redirections_errors(data, exec, 1, 1);
-			close(exec->outfile_fd);
-			exec->outfile_fd = 0;
-		}
-	}
-}
-
 /*This function gets called if there are no pipes, and only one builtin -
 either unset, export with arguments, cd or exit. These builtins need to happen
 in the parent process to actually have any effect, as they're modifying the
-environment. The function checks for redirections (which are not handled in 
-parent, but child, but still makes the check). It executes the builtin, frees 
-the allocated memory, and returns.*/
+environment. Redirections are not applied to the parent, but their targets are
+still opened (and closed again) the same way as bash does: Output files get
+created, and if a target cannot be opened, the error is printed and the
+builtin is not executed. Executes the builtin, frees the allocated memory,
+and returns.*/
 int	execution_only_in_parent(t_data *data, t_exec *exec)
 {
-	check_redirections(data, exec, 0);
-	check_file_exist_parent(data, exec);
+	trace_mark(data, PH_PLAN, PH_EXEC);
+	collect_redirections(data, exec, 0);
+	if (!check_redirections(data, exec))
+	{
+		data->exit_status = 1;
+		free_exec(exec);
+		return (0);
+	}
 	data->exit_status = builtin(data, exec);
+	trace_mark(data, PH_EXEC, PH_OTHER);
 	free_exec(exec);
 	return (0);
 }
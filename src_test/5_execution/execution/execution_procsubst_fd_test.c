@@ -0,0 +1,74 @@
+#include "minishell.h"
+
+/*Creates the pipe of a process substitution, close-on-exec like every pipe of
+the shell, and moves the shell's end to the highest free fd up to
+PROCSUBST_FD_MAX, like bash, out of the way of redirections like '3>file',
+which would otherwise replace it before the command opens it. Sets 'fds' to
+both ends and 'ps->fd' to the shell's one.
+Returns 1 on success, 0 on failure (an error message was printed).*/
+int	open_procsubst_pipe(t_procsubst *ps, int fds[2])
+{
+	int	shell;
+	int	fd;
+
+	shell = (ps->dir == '>');
+	if (pipe2(fds, O_CLOEXEC) == -1)
+	{
+		print_err_msg_prefix("pipe");
+		return (0);
+	}
+	fd = PROCSUBST_FD_MAX;
+	while (fd > STDERR_FILENO && fcntl(fd, F_GETFD) != -1)
+		fd--;
+	errno = EMFILE;
+	ps->fd = -1;
+	if (fd > STDERR_FILENO)
+		ps->fd = dup3(fds[shell], fd, O_CLOEXEC);
+	close(fds[shell]);
+	fds[shell] = ps->fd;
+	if (ps->fd != -1)
+		return (1);
+	print_err_msg_prefix("dup3");
+	close(fds[!shell]);
+	return (0);
+}
+
+/*Checks if an argument names the fd as a file, i.e. contains PROCSUBST_DIR
+followed by its number (also within a word like '--file=/dev/fd/63').*/
+static int	names_fd(char **args, int fd)
+{
+	char	*path;
+
+	while (*args)
+	{
+		path = ft_strnstr(*args, PROCSUBST_DIR, ft_strlen(*args));
+		while (path)
+		{
+			path += ft_strlen(PROCSUBST_DIR);
+			if (ft_isdigit(*path) && ft_atoi(path) == fd)
+				return (1);
+			path = ft_strnstr(path, PROCSUBST_DIR, ft_strlen(path));
+		}
+		args++;
+	}
+	return (0);
+}
+
+/*Called in the child right before execve(): clears close-on-exec on the
+shell's ends of the pipes of the process substitutions the command is given
+as arguments, so only the program using them inherits them. A redirection
+from or to a substitution was already opened before.*/
+void	pass_procsubst_fds(t_data *data, t_exec *exec)
+{
+	t_list		*current;
+	t_procsubst	*ps;
+
+	current = data->procsubst;
+	while (current && exec->flags)
+	{
+		ps = current->content;
+		if (names_fd(exec->flags, ps->fd))
+			fcntl(ps->fd, F_SETFD, 0);
+		current = current->next;
+	}
+}
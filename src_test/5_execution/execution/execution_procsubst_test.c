@@ -0,0 +1,111 @@
+#include "minishell.h"
+
+/*Closes the shell's ends of the pipes of all process substitutions in the
+list.*/
+static void	close_fds(t_list *procsubst)
+{
+	while (procsubst)
+	{
+		close(((t_procsubst *)procsubst->content)->fd);
+		procsubst = procsubst->next;
+	}
+}
+
+/*The subshell of a process substitution: closes the shell's ends of the pipes
+of earlier substitutions, so their commands are not kept waiting for EOF by
+it, and executes the command line with stdout (for '<(cmd)') or stdin (for
+'>(cmd)') connected to the pipe.*/
+static void	procsubst_child(t_data *data, t_procsubst *ps, int fds[2])
+{
+	close_fds(data->procsubst);
+	if (ps->dir == '<')
+		run_subshell(data, fds[1], fds[0], STDOUT_FILENO);
+	run_subshell(data, fds[0], fds[1], STDIN_FILENO);
+}
+
+/*Opens the pipe of a process substitution (see open_procsubst_pipe()) and
+starts its subshell (see procsubst_child()). Input the shell read ahead is
+handed back before forking (see sync_script_input()). The shell keeps the
+other end of the pipe, which is passed on to the command using the
+substitution (see pass_procsubst_fds()).
+Without a command line ('data' is NULL, as it is empty) no subshell is
+started, the command finds the pipe closed right away.
+Returns 1 on success, -1 on failure (an error message was printed).*/
+static int	spawn_procsubst(t_data *data, void *arg)
+{
+	t_procsubst	*ps;
+	int			fds[2];
+
+	ps = arg;
+	if (!open_procsubst_pipe(ps, fds))
+		return (-1);
+	if (data)
+	{
+		sync_script_input(data);
+		ps->pid = fork();
+	}
+	if (data && ps->pid == 0)
+		procsubst_child(data, ps, fds);
+	close(fds[ps->dir == '<']);
+	if (ps->pid != -1)
+		return (1);
+	print_err_msg_prefix("fork");
+	close(ps->fd);
+	return (-1);
+}
+
+/*Starts a process substitution: 'cmd' runs concurrently with the command
+using it (see spawn_procsubst()), which reads its output ('dir' is '<') or
+writes to its input ('dir' is '>'). The substitution is kept in
+data->procsubst until the command finished (see finish_procsubst()).
+Returns the fd of the shell's end of the pipe, -1 on failure (an error
+message was printed).*/
+int	start_procsubst(t_data *data, char *cmd, char dir)
+{
+	t_procsubst	*ps;
+	t_list		*node;
+	int			ret;
+
+	ps = ft_calloc(1, sizeof(t_procsubst));
+	node = ft_lstnew(ps);
+	ret = -1;
+	if (!ps || !node)
+		print_err_msg(ERR_MALLOC);
+	else
+	{
+		ps->dir = dir;
+		if (is_only_whitespace(cmd))
+			ret = spawn_procsubst(NULL, ps);
+		else
+			ret = with_command_line(data, cmd, spawn_procsubst, ps);
+	}
+	if (ret <= 0)
+	{
+		free(ps);
+		free(node);
+		return (-1);
+	}
+	ft_lstadd_back(&data->procsubst, node);
+	return (ps->fd);
+}
+
+/*Finishes the process substitutions of a command once it is done: closes the
+shell's ends of their pipes first (so a '>(cmd)' reads EOF and a '<(cmd)'
+whose output was not read completely is not blocked forever), then waits for
+their subshells. Their exit status does not matter.*/
+void	finish_procsubst(t_data *data)
+{
+	t_list	*current;
+	pid_t	pid;
+
+	close_fds(data->procsubst);
+	current = data->procsubst;
+	while (current)
+	{
+		pid = ((t_procsubst *)current->content)->pid;
+		if (pid > 0)
+			waitpid(pid, NULL, 0);
+		current = current->next;
+	}
+	ft_lstclear(&data->procsubst, free);
+}
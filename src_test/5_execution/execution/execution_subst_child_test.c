@@ -0,0 +1,115 @@
+#include "minishell.h"
+
+/*Executes the tokens of a command line: a line with control flow is parsed
+into a command list first (see run_compound()), any other line is parsed and
+executed as one pipeline. Its process substitutions are finished after.*/
+void	run_tokens(t_data *data)
+{
+	if (is_compound(data))
+		run_compound(data);
+	else if (parse_tokens(data))
+	{
+		handle_signals_exec();
+		sync_script_input(data);
+		trace_lap(data);
+		init_exec(data);
+	}
+	finish_procsubst(data);
+}
+
+/*Reads everything a subshell writes into the pipe until it is closed, and
+appends it to 'out', which grows as needed.
+Returns 1 on success, -1 on failure (an error message was printed).*/
+static int	read_output(int fd, t_strbuf *out)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n != 0)
+	{
+		if (!ft_sb_reserve(out, SUBST_READ_SIZE))
+		{
+			print_err_msg(ERR_MALLOC);
+			return (-1);
+		}
+		n = read(fd, out->buf + out->len, SUBST_READ_SIZE);
+		if (n == -1 && errno != EINTR)
+		{
+			print_err_msg_prefix("read");
+			return (-1);
+		}
+		if (n > 0)
+			out->len += n;
+		out->buf[out->len] = '\0';
+	}
+	return (1);
+}
+
+/*The subshell of a command or process substitution: executes the command line
+with 'target' (stdin or stdout) connected to the pipe end 'keep', and exits
+with its exit status. The other end of the pipe is closed.*/
+void	run_subshell(t_data *data, int keep, int other, int target)
+{
+	unsigned int	status;
+
+	close(other);
+	if (dup2(keep, target) == -1)
+	{
+		print_err_msg_prefix("dup2");
+		exit(EXIT_FAILURE);
+	}
+	close(keep);
+	run_tokens(data);
+	status = data->exit_status;
+	free_data(data, 1);
+	exit(status);
+}
+
+/*Waits for the subshell of a command substitution and takes over its exit
+status (128 + the signal number if it was killed by a signal).*/
+static void	wait_subshell(t_data *data, pid_t pid)
+{
+	int	stat_loc;
+
+	if (waitpid(pid, &stat_loc, 0) == -1)
+		return ;
+	if (WIFEXITED(stat_loc))
+		data->exit_status = WEXITSTATUS(stat_loc);
+	else if (WIFSIGNALED(stat_loc))
+		data->exit_status = 128 + WTERMSIG(stat_loc);
+}
+
+/*Runs the command line of a command substitution in a subshell and reads its
+output from a pipe into 'out'. Input the shell read ahead is handed back
+before forking (see sync_script_input()), so the subshell and the shell
+continue reading from the same place. The exit status is the subshell's.
+Like the pipes of a pipeline, the pipe is close-on-exec, so no command
+executed by the subshell inherits its ends other than as stdout (dup2()
+clears the flag on the copy).
+Returns 1 on success, -1 on failure (an error message was printed).*/
+int	capture_child(t_data *data, t_strbuf *out)
+{
+	int		fds[2];
+	pid_t	pid;
+	int		ret;
+
+	sync_script_input(data);
+	if (pipe2(fds, O_CLOEXEC) == -1)
+	{
+		print_err_msg_prefix("pipe");
+		return (-1);
+	}
+	pid = fork();
+	if (pid == 0)
+		run_subshell(data, fds[1], fds[0], STDOUT_FILENO);
+	close(fds[1]);
+	ret = -1;
+	if (pid == -1)
+		print_err_msg_prefix("fork");
+	else
+		ret = read_output(fds[0], out);
+	close(fds[0]);
+	if (pid != -1)
+		wait_subshell(data, pid);
+	return (ret);
+}
@@ -4,8 +4,8 @@
 1.Converts the envp_temp linked list to an array. 
 2. Extracts the command and its flags and stores the command in a string and 
 the command + flags in an array.
-3. Checks if there are any redirections, and stores the file indicated to be 
-redirected to. 
+3. Collects the redirections of the command in order, which are then applied
+together with the pipes.
 4. Makes a check to see if there are any "/"-signs found in the command, meaning
 it is a path. Also checks if it's a builtin.
 (5. If the previous point is the case, the next two points are not executed.
@@ -17,7 +17,7 @@ defined in the command-input.
 void	prep_execution(t_data *data, t_exec *exec, int position)
 {
 	conv_env_tmp_to_arr(data, exec);
-	check_redirections(data, exec, position);
+	collect_redirections(data, exec, position);
 	get_flags_and_command(data, exec, position);
 	do_redirections(data, exec);
 	if (!cmd_is_path(data, exec) && !is_builtin(exec))
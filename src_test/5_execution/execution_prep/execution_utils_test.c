@@ -33,21 +33,16 @@ void	conv_env_tmp_to_arr(t_data *data, t_exec *exec)
 {
 	int		i;
 	t_env	*current;
-	char	*tmp;
 
 	i = 0;
-	tmp = NULL;
 	current = data->envp_temp;
 	exec->envp_temp_arr = malloc(sizeof(char *) * (count_env_list(data) + 1));
 	if (!exec->envp_temp_arr)
 		exec_errors(data, exec, 1);
 	while (current)
 	{
-		tmp = ft_strjoin(current->e_var, "=");
-		if (!tmp)
-			conversion_errors(data, exec, i);
-		exec->envp_temp_arr[i] = ft_strjoin(tmp, current->value);
-		free(tmp);
+		exec->envp_temp_arr[i] = ft_strjoin_n(3, current->e_var, "=",
+				current->value);
 		if (!exec->envp_temp_arr[i])
 			conversion_errors(data, exec, i);
 		i++;
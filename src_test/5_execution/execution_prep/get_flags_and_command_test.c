@@ -21,7 +21,7 @@ void	set_flags_and_cmd(t_data *data, t_exec *exec, int position, int count)
 	exec->cmd = ft_strdup(token->lexeme);
 	if (!exec->cmd)
 		exec_errors(data, exec, 1);
-	while (i < count && token->type != REDIR_IN && token->type != REDIR_OUT)
+	while (i < count && !is_redir_token(token->type))
 	{
 		exec->flags[i] = ft_strdup(token->lexeme);
 		if (!exec->flags[i])
@@ -49,8 +49,7 @@ void	get_flags_and_command(t_data *data, t_exec *exec, int position)
 		move_current_and_update_token(&current, &token);
 	while (current && token->type != PIPE)
 	{
-		if (token->type == REDIR_IN || token->type == REDIR_OUT 
-			|| token->type == APPEND_OUT)
+		if (is_redir_token(token->type))
 			move_current_and_update_token(&current, &token);
 		else
 		{
@@ -1,72 +1,84 @@
 #include "minishell.h"
 
-void	check_file_exist_child(t_data *data, t_exec *exec)
+/*Duplicates 'from' onto 'to'. If they are the same already (e.g. a target
+opened for '3>file' got fd 3), the close-on-exec flag the shell opens its fds
+with is cleared instead, so the command still finds the fd.*/
+static void	redirect_fd(t_data *data, t_exec *exec, int from, int to)
 {
-	if (exec->redir_in)
-	{
-		if (access(exec->infile, F_OK) == -1)
-			redirections_errors(data, exec, 0, 0);
-	}
-	if (exec->redir_out)
-	{
-		if (access(exec->outfile, F_OK == -1))
-		{
-			exec->outfile_fd = open(exec->outfile, O_CREAT);
-			if (exec->outfile_fd == -1)
-				redirections_errors(data, exec, 1, 0);
-			close(exec->outfile_fd);
-			exec->outfile_fd = 0;
-		}
-	}
+	if (from == to && fcntl(from, F_SETFD, 0) == -1)
+		redirections_errors(data, exec, "fcntl", 0);
+	else if (from != to && dup2(from, to) == -1)
+		redirections_errors(data, exec, "dup2", 0);
 }
 
-static void	redir_in(t_data *data, t_exec *exec)
+/*Handles '<&' and '>&': If the target is '-', the fd gets closed ('2>&-'),
+otherwise the fd gets duplicated from the target fd ('2>&1', see
+redirect_fd()). Here-strings are handled the same way, their target is the
+fd of the memory file holding the string (see open_herestrings()). A target
+that is not a fd number, or not an open fd, is an error.*/
+static void	dup_redirection(t_data *data, t_exec *exec, t_redir *redir)
 {
-	exec->infile_fd = open(exec->infile, O_RDONLY);
-	if (exec->infile_fd == -1)
-		redirections_errors(data, exec, 0, 0);
-	if (dup2(exec->infile_fd, STDIN_FILENO) == -1)
-		redirections_errors(data, exec, 0, 0);
-	close(exec->infile_fd);
+	int	i;
+
+	if (ft_strcmp(redir->target, "-") == 0)
+	{
+		close(redir->fd);
+		return ;
+	}
+	i = 0;
+	while (ft_isdigit(redir->target[i]))
+		i++;
+	errno = EBADF;
+	if (i == 0 || redir->target[i] != '\0'
+		|| fcntl(ft_atoi(redir->target), F_GETFD) == -1)
+		redirections_errors(data, exec, redir->target, 0);
+	redirect_fd(data, exec, ft_atoi(redir->target), redir->fd);
 }
 
-static void	redir_out(t_data *data, t_exec *exec)
+/*Applies one redirection: Opens its target, duplicates it onto the fd the
+redirection applies to (for '&>' and '&>>' also onto STDERR) and closes the
+opened fd again, unless it already is one of these.*/
+static void	apply_redirection(t_data *data, t_exec *exec, t_redir *redir)
 {
-	if (exec->append_out)
-		exec->outfile_fd = open(exec->outfile, O_WRONLY | O_APPEND);
-	else
-		exec->outfile_fd = open(exec->outfile, O_WRONLY | O_TRUNC);
-	if (exec->outfile_fd == -1)
-		redirections_errors(data, exec, 1, 0);
-	if (dup2(exec->outfile_fd, STDOUT_FILENO) == -1)
-		redirections_errors(data, exec, 1, 0);
-	close (exec->outfile_fd);
+	int		fd;
+	bool	all;
+
+	if (redir->type == DUP_IN || redir->type == DUP_OUT
+		|| redir->type == HERESTRING)
+	{
+		dup_redirection(data, exec, redir);
+		return ;
+	}
+	fd = open_redirection(redir);
+	if (fd == -1)
+		redirections_errors(data, exec, redir->target, 0);
+	all = (redir->type == ALL_OUT || redir->type == ALL_APPEND);
+	if (all)
+		redirect_fd(data, exec, fd, STDERR_FILENO);
+	redirect_fd(data, exec, fd, redir->fd);
+	if (fd != redir->fd && !(all && fd == STDERR_FILENO))
+		close(fd);
 }
 
+/*Connects the fds of the current child: First STDIN and STDOUT get connected
+to the pipes of the pipeline, and all pipe ends are closed. Then the
+redirections of the command are applied in order, so they take precedence
+over the pipes (and e.g. '2>&1' refers to the pipe if there is one).*/
 void	do_redirections(t_data *data, t_exec *exec)
 {
-	if (exec->redir_in)
-		redir_in(data, exec);
-	else if (exec->curr_child > 0)
-	{
-		if (dup2(exec->prev_pipe_fd[0], STDIN_FILENO) == -1)
-			redirections_errors(data, exec, 0, 0);
-	}
-	if (exec->redir_out)
-		redir_out(data, exec);
-	else if (exec->curr_child < data->pipe_nr)
-	{
-		if (dup2(exec->pipe_fd[1], STDOUT_FILENO) == -1)
-			redirections_errors(data, exec, 1, 0);
-	}
+	t_list	*current;
+
 	if (exec->curr_child > 0)
-	{
-		close(exec->prev_pipe_fd[0]);
-		close(exec->prev_pipe_fd[1]);
-	}
+		redirect_fd(data, exec, exec->pipes[(exec->curr_child - 1) * 2],
+			STDIN_FILENO);
 	if (exec->curr_child < data->pipe_nr)
+		redirect_fd(data, exec, exec->pipes[exec->curr_child * 2 + 1],
+			STDOUT_FILENO);
+	close_pipes(data, exec);
+	current = exec->redirs;
+	while (current)
 	{
-		close(exec->pipe_fd[0]);
-		close(exec->pipe_fd[1]);
+		apply_redirection(data, exec, (t_redir *)current->content);
+		current = current->next;
 	}
 }
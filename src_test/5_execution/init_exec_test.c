@@ -5,6 +5,8 @@ t_exec	*set_exec_members_to_null(t_exec *exec)
 {
 	exec->curr_child = 0;
 	exec->count_flags = 0;
+	exec->pipes = NULL;
+	exec->redirs = NULL;
 	exec->all_paths = NULL;
 	exec->cmd = NULL;
 	exec->current_path = NULL;
@@ -12,15 +14,10 @@ t_exec	*set_exec_members_to_null(t_exec *exec)
 	exec->input = NULL;
 	exec->child = NULL;
 	exec->envp_temp_arr = NULL;
-	exec->redir_in = 0;
-	exec->redir_out = 0;
-	exec->append_out = 0;
-	exec->infile = NULL;
-	exec->outfile = NULL;
 	exec->first = 1;
-	exec->infile_fd = 0;
-	exec->outfile_fd = 1;
 	exec->cmd_found = 0;
+	ft_sb_init(&exec->out);
+	exec->capture = NULL;
 	return (exec);
 }
 
@@ -0,0 +1,90 @@
+/**
+This file contains a debug check for file descriptor hygiene: Every fd the
+minishell opens internally (pipes, heredocs, history, redirection files) is
+created with O_CLOEXEC, so nothing but STDIN, STDOUT and STDERR should survive
+into an executed program, apart from the pipes of process substitutions
+named in its arguments, which it opens via /dev/fd (see
+execution_procsubst_fd.c). Leaked write ends of pipes would delay EOF and keep
+downstream commands of a pipeline blocked.
+
+The check is only compiled in when building with 'make DEBUG_FDS=1',
+otherwise it does nothing.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	check_fd_leaks(t_data *data, t_exec *exec);
+
+#ifdef DEBUG_FDS
+
+/**
+Used in check_fd_leaks().
+
+Checks if a fd is the shell's end of the pipe of a process substitution,
+which is meant to be inherited by the executed program.
+*/
+static int	is_procsubst_fd(t_data *data, int fd)
+{
+	t_list	*current;
+
+	current = data->procsubst;
+	while (current)
+	{
+		if (((t_procsubst *)current->content)->fd == fd)
+			return (1);
+		current = current->next;
+	}
+	return (0);
+}
+
+/**
+Called in the child right before execve().
+
+Scans the fds above STDERR (up to FD_CHECK_MAX) for descriptors that are open
+and not marked close-on-exec, i.e. that would be inherited by the executed
+program, other than those of process substitutions. Prints each leaked fd
+and aborts, so the leak cannot go unnoticed.
+
+ @param data 	The data struct, holding the process substitutions.
+ @param exec 	The exec struct, holding the command about to be executed.
+*/
+void	check_fd_leaks(t_data *data, t_exec *exec)
+{
+	int	fd;
+	int	flags;
+	int	leaks;
+
+	fd = STDERR_FILENO + 1;
+	leaks = 0;
+	while (fd < FD_CHECK_MAX)
+	{
+		flags = fcntl(fd, F_GETFD);
+		if (flags != -1 && !(flags & FD_CLOEXEC)
+			&& !is_procsubst_fd(data, fd))
+		{
+			ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
+			ft_putstr_fd("debug: fd ", STDERR_FILENO);
+			ft_putnbr_fd(fd, STDERR_FILENO);
+			ft_putstr_fd(" leaks into '", STDERR_FILENO);
+			ft_putstr_fd(exec->cmd, STDERR_FILENO);
+			ft_putstr_fd("'\n", STDERR_FILENO);
+			leaks++;
+		}
+		fd++;
+	}
+	if (leaks)
+		abort();
+}
+
+#else
+
+// Without DEBUG_FDS, the check is compiled out.
+void	check_fd_leaks(t_data *data, t_exec *exec)
+{
+	(void)data;
+	(void)exec;
+}
+
+#endif
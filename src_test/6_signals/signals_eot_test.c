@@ -16,6 +16,8 @@ void	handle_eot_heredoc(char *delim);
 
 /**
 Handles cleanup and program termination in response to the CTRL + D exit signal.
+At the end of a script (non-interactive mode), minishell exits silently with
+the exit status of the last command instead, like bash.
 
  @param data 	A pointer to a data structure, which will be cleaned up.
  @param str 	A pointer to a dynamically allocated string or buffer to be
@@ -24,9 +26,15 @@ Handles cleanup and program termination in response to the CTRL + D exit signal.
 */
 void	handle_eot(t_data *data)
 {
-	printf("exit\n");
+	unsigned int	exit_status;
+
+	exit_status = 0;
+	if (data->interactive)
+		printf("exit\n");
+	else
+		exit_status = data->exit_status;
 	cleanup(data, 1);
-	exit(0);
+	exit(exit_status);
 }
 
 /**
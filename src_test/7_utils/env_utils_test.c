@@ -0,0 +1,115 @@
+/**
+This file contains utility functions to access the minishell's own list of
+environment variables (`envp_temp`), to set a variable from within the shell,
+and to manage the slab the environment is imported into at startup.
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+char		*get_env_value(t_env *env, const char *var_name);
+int			set_env_var(t_data *data, const char *name, const char *value);
+t_env_slab	*get_env_slab(void);
+void		env_free(void *ptr);
+void		free_env_slab(void);
+
+/**
+Looks up the value of an environment variable in the passed list.
+
+ @param env 		The list of environment variables (e.g. `envp_temp`).
+ @param var_name 	The name of the variable to look up.
+
+ @return	A pointer to the variable's value (not a copy; must not be freed).
+			`NULL` if the variable is not found or has no value.
+*/
+char	*get_env_value(t_env *env, const char *var_name)
+{
+	while (env)
+	{
+		if (ft_strcmp(env->e_var, var_name) == 0)
+			return (env->value);
+		env = env->next;
+	}
+	return (NULL);
+}
+
+/**
+Sets a variable in both lists of environment variables, like
+`export NAME=value`, e.g. the loop variable of a `for` loop or a variable
+assigned in an arithmetic expression (minishell has no shell variables).
+
+ @param data 	Pointer to the data struct.
+ @param name 	The name of the variable.
+ @param value 	Its new value.
+
+ @return	`1` on success.
+			`0` on malloc failure (an error message was printed and the exit
+			status set to `1`).
+*/
+int	set_env_var(t_data *data, const char *name, const char *value)
+{
+	t_strbuf	sb;
+
+	ft_sb_init(&sb);
+	if (!ft_sb_adds(&sb, name) || !ft_sb_addc(&sb, '=')
+		|| !ft_sb_adds(&sb, value))
+	{
+		ft_sb_free(&sb);
+		print_err_msg(ERR_MALLOC);
+		data->exit_status = 1;
+		return (0);
+	}
+	add_env_var_envp_with_value(data, sb.buf);
+	add_env_var_export_with_value(data, sb.buf);
+	ft_sb_free(&sb);
+	return (1);
+}
+
+/**
+Returns the slab the environment was imported into at startup. There is only
+one per process, so it is kept here instead of being passed around to every
+function that frees a node of the env lists.
+*/
+t_env_slab	*get_env_slab(void)
+{
+	static t_env_slab	slab;
+
+	return (&slab);
+}
+
+/**
+Frees a node or a string of the envp_temp or export list, unless it is part
+of the slab: Those are shared by both lists and freed all at once by
+free_env_slab().
+
+ @param ptr 	The node or string to be freed.
+*/
+void	env_free(void *ptr)
+{
+	t_env_slab	*slab;
+	uintptr_t	addr;
+
+	slab = get_env_slab();
+	addr = (uintptr_t)ptr;
+	if (slab->start && addr >= (uintptr_t)slab->start
+		&& addr < (uintptr_t)slab->start + slab->size)
+		return ;
+	free(ptr);
+}
+
+/**
+Used in free_data().
+
+Frees the slab, once no list refers to it anymore.
+*/
+void	free_env_slab(void)
+{
+	t_env_slab	*slab;
+
+	slab = get_env_slab();
+	free(slab->start);
+	slab->start = NULL;
+	slab->size = 0;
+	slab->count = 0;
+}
@@ -78,10 +78,13 @@ void	delete_heredocs(t_data *data)
 
 /**
 Frees all resources allocated within the minishell program.
-This includes deallocating memory for tokens, and input strings.
+This includes deallocating memory for tokens, the command list and input
+strings.
 If the function is called within an 'exit' context, also allocated memory
-for absolute paths (working directory, history file), and the export as well
-as environment variable list are freed.
+for absolute paths (working directory, history file), the export as well
+as environment variable list and the parse cache are freed, as are the lists
+of process substitutions (a child leaves them to the shell) and of heredoc
+lines read ahead.
 
  @param data Pointer to the t_data structure containing all allocated resources.
  @param exit Boolean flag indicating whether to free environment variables and
@@ -92,19 +95,27 @@ void	free_data(t_data *data, bool exit)
 	if (!data)
 		return ;
 	ft_lstclear(&data->tok.tok_lst, del_token);
-	if (data->input)
-		free(data->input);
+	data->tok.tok_last = NULL;
+	free_nodes(data->program);
+	data->program = NULL;
+	free(data->input);
 	data->pipe_nr = 0; // reset number of pipes to default.
 	if (exit)
 	{
-		if (data->working_dir)
-			free(data->working_dir);
+		ft_lstclear(&data->procsubst, free);
+		ft_lstclear(&data->heredoc_lines, free);
+		free(data->working_dir);
 		if (data->path_to_hist_file)
 			free(data->path_to_hist_file);
 		if (data->envp_temp)
 			free_env_struct(&data->envp_temp);
 		if (data->export_list)
 			free_env_struct(&data->export_list);
+		free_env_slab();
+		free_parse_cache(&data->cache);
+		ft_gnl_close(&data->script);
+		trace_finish(data);
+		memstat_finish();
 	}
 }
 
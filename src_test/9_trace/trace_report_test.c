@@ -0,0 +1,93 @@
+/**
+This file contains the report of the latency trace after each command line,
+with the time spent in each phase it went through, e.g.
+
+	[trace] line 3: quotes 1us tokens 4us plan 35us ... total 1391us
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+const char	*trace_phase_name(t_phase phase);
+void		trace_write(t_trace *trace, t_strbuf *sb, int ok);
+void		trace_line_end(t_data *data, unsigned long start);
+
+/**
+Returns the name of a phase, as printed in the reports.
+*/
+const char	*trace_phase_name(t_phase phase)
+{
+	static const char	*names[PH_COUNT] = {"quotes", "tokens", "heredocs",
+		"expansion", "plan", "fork", "exec", "wait", "total", "other"};
+
+	return (names[phase]);
+}
+
+/**
+Returns the histogram bucket of a duration: `0` below 1 us, `k` below
+2^k us (the last bucket also holds all longer durations).
+*/
+static int	get_bucket(unsigned long ns)
+{
+	unsigned long	us;
+	int				bucket;
+
+	us = ns / 1000;
+	bucket = 0;
+	while (us > 0 && bucket < TRACE_BUCKETS - 1)
+	{
+		us >>= 1;
+		bucket++;
+	}
+	return (bucket);
+}
+
+/**
+Writes a report to the trace's fd with a single write and frees it. Nothing
+is written if building the report failed (`ok` is `0`).
+*/
+void	trace_write(t_trace *trace, t_strbuf *sb, int ok)
+{
+	if (ok && sb->buf)
+		write(trace->fd, sb->buf, sb->len);
+	ft_sb_free(sb);
+}
+
+/**
+Used in main().
+
+Ends the trace of a command line: Reports the time spent in each phase it
+went through, adds them to the histograms and resets them for the next line.
+
+ @param data 	Pointer to the data struct.
+ @param start 	The start of the line, from trace_now().
+*/
+void	trace_line_end(t_data *data, unsigned long start)
+{
+	t_trace		*trace;
+	t_strbuf	sb;
+	int			ok;
+	int			phase;
+
+	if (!data->trace)
+		return ;
+	trace_add(data, PH_TOTAL, start);
+	trace = data->trace;
+	ft_sb_init(&sb);
+	ok = ft_sb_adds(&sb, "[trace] line ")
+		&& ft_sb_addnbr(&sb, (int)++trace->lines) && ft_sb_adds(&sb, ":");
+	phase = -1;
+	while (++phase < PH_COUNT)
+	{
+		if (!trace->line_ns[phase])
+			continue ;
+		trace->hist[phase][get_bucket(trace->line_ns[phase])]++;
+		ok = ok && ft_sb_addc(&sb, ' ')
+			&& ft_sb_adds(&sb, trace_phase_name(phase)) && ft_sb_addc(&sb, ' ')
+			&& ft_sb_addnbr(&sb, (int)(trace->line_ns[phase] / 1000))
+			&& ft_sb_adds(&sb, "us");
+		trace->line_ns[phase] = 0;
+	}
+	trace_write(trace, &sb, ok && ft_sb_addc(&sb, '\n'));
+}
@@ -0,0 +1,106 @@
+/**
+This file contains the report of the latency trace when minishell exits: a
+histogram of the durations of each phase over all command lines, e.g.
+
+	[trace] tokens: <4us 2 <8us 1
+
+meaning two lines took 2-3 microseconds to tokenize, one took 4-7. It also
+reports how many lines were found in the parse cache (see tokenizer_cache.c).
+*/
+
+#include "minishell.h"
+
+// IN FILE:
+
+void	trace_summary(t_data *data);
+
+/**
+Used in trace_summary().
+
+Checks if a phase was measured at all, i.e. if any of its buckets is used.
+*/
+static int	is_measured(unsigned long *hist)
+{
+	int	bucket;
+
+	bucket = 0;
+	while (bucket < TRACE_BUCKETS)
+	{
+		if (hist[bucket++])
+			return (1);
+	}
+	return (0);
+}
+
+/**
+Used in trace_summary().
+
+Adds the histogram of one phase to the report: the number of lines per
+bucket (see get_bucket() in trace_report.c), skipping empty buckets.
+
+ @param sb 		The report.
+ @param hist 	The buckets of the phase.
+ @param phase 	The phase.
+
+ @return	`1` on success, `0` on malloc failure.
+*/
+static int	add_histogram(t_strbuf *sb, unsigned long *hist, t_phase phase)
+{
+	int	ok;
+	int	bucket;
+
+	ok = ft_sb_adds(sb, "[trace] ") && ft_sb_adds(sb, trace_phase_name(phase))
+		&& ft_sb_addc(sb, ':');
+	bucket = -1;
+	while (++bucket < TRACE_BUCKETS)
+	{
+		if (!hist[bucket])
+			continue ;
+		ok = ok && ft_sb_adds(sb, " <") && ft_sb_addnbr(sb, 1 << bucket)
+			&& ft_sb_adds(sb, "us ") && ft_sb_addnbr(sb, (int)hist[bucket]);
+	}
+	return (ok && ft_sb_addc(sb, '\n'));
+}
+
+/**
+Used in trace_summary().
+
+Adds the hits and misses of the parse cache to the report, e.g.
+
+	[trace] parse cache: 998 hits 2 misses
+*/
+static int	add_cache_stats(t_strbuf *sb, t_parse_cache *cache)
+{
+	return (ft_sb_adds(sb, "[trace] parse cache: ")
+		&& ft_sb_addunbr(sb, cache->hits) && ft_sb_adds(sb, " hits ")
+		&& ft_sb_addunbr(sb, cache->misses) && ft_sb_adds(sb, " misses\n"));
+}
+
+/**
+Used in trace_finish().
+
+Reports the number of traced command lines, the hits and misses of the parse
+cache and the histogram of each phase that was measured at least once.
+
+ @param data 	Pointer to the data struct.
+*/
+void	trace_summary(t_data *data)
+{
+	t_trace		*trace;
+	t_strbuf	sb;
+	int			ok;
+	int			phase;
+
+	trace = data->trace;
+	ft_sb_init(&sb);
+	ok = ft_sb_adds(&sb, "[trace] lines: ")
+		&& ft_sb_addnbr(&sb, (int)trace->lines) && ft_sb_addc(&sb, '\n')
+		&& add_cache_stats(&sb, &data->cache);
+	phase = -1;
+	while (++phase < PH_COUNT)
+	{
+		if (is_measured(trace->hist[phase]))
+			ok = ok && add_histogram(&sb, trace->hist[phase], phase);
+	}
+	trace_write(trace, &sb, ok);
+}